@@ -0,0 +1,334 @@
+/**
+ * @file   AllPairs.c
+ * @author Hugo Lopes_30516
+ *
+ * @brief Implementao do clculo de caminhos entre todos os pares de vrtices (Floyd-Warshall por blocos).
+ *
+ * @date   Outubro 2026
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <malloc.h>
+#include <stdbool.h>
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
+#include "Graph.h"
+#include "CSR.h"
+#include "AllPairs.h"
+
+/* Valor interno das entradas sem caminho */
+#define AP_INFINITO ((long long)1 << 62)
+
+/* Limite das somas: um caminho verdadeiro tem no mximo V - 1 adjacncias de 32 bits (menos de 2^46
+   em valor absoluto), pelo que uma soma s chega a AP_LIMITE se uma das parcelas for AP_INFINITO,
+   e s desce abaixo de -AP_LIMITE se houver um ciclo negativo */
+#define AP_LIMITE ((long long)1 << 61)
+
+
+#pragma region Liberta a memria de uma estrutura de caminhos entre todos os pares.
+/**
+ * @brief Liberta a memria de uma estrutura criada por AllPairsCSR ou AllPairsGraph.
+ *
+ * @param ap A estrutura a libertar.
+ * @param res Apontador para um booleano que indica se a operao foi bem-sucedida.
+ * @return NULL (no h mais estrutura para apontar).
+ */
+AllPairs* DestroyAllPairs(AllPairs* ap, bool* res)
+{
+    if (ap == NULL)
+    {
+        *res = false;
+        return NULL;
+    }
+
+    free(ap->ids);
+    free(ap->distancia);
+    free(ap->anteriores);
+    free(ap);
+
+    *res = true;
+    return NULL;
+}
+#pragma endregion
+
+
+#pragma region Relaxa uma linha da matriz atravs de um vrtice intermdio.
+/**
+ * @brief di[j] = min(di[j], dik + dk[j]) para j em [0, tam), copiando o antecessor pk[j] quando melhora.
+ *
+ * As somas que chegam a AP_LIMITE (dk[j] sem caminho) passam a AP_INFINITO, e as que descem
+ * abaixo de -AP_LIMITE (s com ciclos negativos) ficam em -AP_LIMITE, pelo que nenhuma soma
+ * transborda. tam tem de ser mltiplo de 4.
+ */
+static void RelaxaLinha(long long* di, int* pi, const long long* dk, const int* pk, long long dik, int tam)
+{
+#ifdef __AVX2__
+    const __m256i vik = _mm256_set1_epi64x(dik);
+    const __m256i minimo = _mm256_set1_epi64x(-AP_LIMITE);
+    const __m256i maximo = _mm256_set1_epi64x(AP_LIMITE - 1);
+    const __m256i infinito = _mm256_set1_epi64x(AP_INFINITO);
+    const __m256i pares = _mm256_setr_epi32(0, 2, 4, 6, 0, 2, 4, 6);
+
+    for (int j = 0; j < tam; j += 4)
+    {
+        __m256i soma = _mm256_add_epi64(vik, _mm256_loadu_si256((const __m256i*)(dk + j)));
+        soma = _mm256_blendv_epi8(soma, minimo, _mm256_cmpgt_epi64(minimo, soma));
+        soma = _mm256_blendv_epi8(soma, infinito, _mm256_cmpgt_epi64(soma, maximo));
+
+        __m256i d = _mm256_loadu_si256((const __m256i*)(di + j));
+        __m256i melhora = _mm256_cmpgt_epi64(d, soma);
+        _mm256_storeu_si256((__m256i*)(di + j), _mm256_blendv_epi8(d, soma, melhora));
+
+        // Os antecessores so de 32 bits: a mscara de 4 x 64 bits  reduzida a 4 x 32 bits
+        __m128i melhora32 = _mm256_castsi256_si128(_mm256_permutevar8x32_epi32(melhora, pares));
+        __m128i p = _mm_loadu_si128((const __m128i*)(pi + j));
+        _mm_storeu_si128((__m128i*)(pi + j), _mm_blendv_epi8(p, _mm_loadu_si128((const __m128i*)(pk + j)), melhora32));
+    }
+#else
+    for (int j = 0; j < tam; j++)
+    {
+        long long soma = dik + dk[j];
+        if (soma < -AP_LIMITE) soma = -AP_LIMITE;
+        if (soma >= AP_LIMITE) soma = AP_INFINITO;
+        if (soma < di[j])
+        {
+            di[j] = soma;
+            pi[j] = pk[j];
+        }
+    }
+#endif
+}
+#pragma endregion
+
+
+#pragma region Relaxa um bloco da matriz atravs dos vrtices intermdios de outro bloco.
+/**
+ * @brief Aplica ao bloco (bi, bj) os vrtices intermdios do bloco bk, lendo (bi, bk) e (bk, bj).
+ *
+ * Os blocos podem coincidir (fases 1 e 2 do algoritmo): como k  o ciclo exterior, cada passo
+ * l a linha e a coluna k j atualizadas, tal como no algoritmo sem blocos.
+ */
+static void RelaxaBloco(AllPairs* ap, int bi, int bj, int bk)
+{
+    int L = ap->tamLinha;
+    int j0 = bj * AP_BLOCO;
+    int fimI = (bi + 1) * AP_BLOCO < ap->n ? (bi + 1) * AP_BLOCO : ap->n;
+    int fimK = (bk + 1) * AP_BLOCO < ap->n ? (bk + 1) * AP_BLOCO : ap->n;
+
+    for (int k = bk * AP_BLOCO; k < fimK; k++)
+    {
+        const long long* dk = ap->distancia + (size_t)k * L + j0;
+        const int* pk = ap->anteriores + (size_t)k * L + j0;
+        for (int i = bi * AP_BLOCO; i < fimI; i++)
+        {
+            long long dik = ap->distancia[(size_t)i * L + k];
+            if (dik == AP_INFINITO) continue; // No h caminho de i at k
+
+            RelaxaLinha(ap->distancia + (size_t)i * L + j0, ap->anteriores + (size_t)i * L + j0, dk, pk, dik, AP_BLOCO);
+        }
+    }
+}
+#pragma endregion
+
+
+#pragma region ALGORITMOS
+
+/**
+ * @brief Calcula os caminhos mais curtos ou mais pesados entre todos os pares de vrtices de uma estrutura CSR.
+ *
+ * Constri a matriz de distncias (com o menor peso de cada par de vrtices adjacentes,
+ * ou o maior em AP_MAIS_PESADO) e aplica o algoritmo de Floyd-Warshall por blocos: para cada
+ * bloco diagonal k, relaxa primeiro o prprio bloco, depois os blocos da linha e da coluna k
+ * e, por fim, os restantes. O custo  O(V^3) com V^2 posies de memria por matriz.
+ * As distncias so de 64 bits, pelo que a soma dos pesos de um caminho nunca transborda. Se houver um ciclo
+ * negativo (ou positivo em AP_MAIS_PESADO), ap->ciclo fica a true e as distncias dos
+ * pares afetados no correspondem a caminhos simples.
+ *
+ * @param c A estrutura CSR.
+ * @param modo AP_MAIS_CURTO ou AP_MAIS_PESADO.
+ * @param res Apontador para um booleano que indica se a operao foi bem-sucedida.
+ * @return Um apontador para a estrutura criada, ou NULL se faltar memria ou as matrizes excederem AP_MAX_BYTES.
+ */
+AllPairs* AllPairsCSR(CSR* c, int modo, bool* res)
+{
+    *res = false;
+    if (c == NULL || (modo != AP_MAIS_CURTO && modo != AP_MAIS_PESADO)) return NULL;
+
+    int n = c->numVertices;
+    int L = (n + AP_BLOCO - 1) / AP_BLOCO * AP_BLOCO;
+    size_t posicoes = (size_t)L * L;
+    if (posicoes * sizeof(long long) > AP_MAX_BYTES) return NULL;
+
+    AllPairs* ap = (AllPairs*)calloc(1, sizeof(AllPairs));
+    if (ap == NULL) return NULL;
+    ap->n = n;
+    ap->tamLinha = L;
+    ap->modo = modo;
+
+    ap->ids = (int*)malloc((n > 0 ? n : 1) * sizeof(int));
+    ap->distancia = (long long*)malloc((posicoes > 0 ? posicoes : 1) * sizeof(long long));
+    ap->anteriores = (int*)malloc((posicoes > 0 ? posicoes : 1) * sizeof(int));
+    if (ap->ids == NULL || ap->distancia == NULL || ap->anteriores == NULL)
+    {
+        DestroyAllPairs(ap, res);
+        *res = false;
+        return NULL;
+    }
+    if (n > 0) memcpy(ap->ids, c->ids, n * sizeof(int));
+
+    // Matriz inicial: 0 na diagonal, o peso das adjacncias e AP_INFINITO nas restantes posies
+    for (size_t p = 0; p < posicoes; p++)
+    {
+        ap->distancia[p] = AP_INFINITO;
+        ap->anteriores[p] = -1;
+    }
+    for (int u = 0; u < n; u++)
+    {
+        ap->distancia[(size_t)u * L + u] = 0;
+        for (int e = c->offsets[u]; e < c->offsets[u + 1]; e++)
+        {
+            long long w = (modo == AP_MAIS_PESADO) ? -(long long)c->pesos[e] : c->pesos[e];
+
+            size_t p = (size_t)u * L + c->destinos[e];
+            if (w < ap->distancia[p])
+            {
+                ap->distancia[p] = w;
+                ap->anteriores[p] = u;
+            }
+        }
+    }
+
+    int blocos = L / AP_BLOCO;
+    for (int k = 0; k < blocos; k++)
+    {
+        // Fase 1: bloco diagonal
+        RelaxaBloco(ap, k, k, k);
+
+        // Fase 2: blocos da linha e da coluna k (dependem apenas do bloco diagonal)
+        for (int b = 0; b < blocos; b++)
+        {
+            if (b == k) continue;
+            RelaxaBloco(ap, k, b, k);
+            RelaxaBloco(ap, b, k, k);
+        }
+
+        // Fase 3: restantes blocos (dependem dos blocos da linha e da coluna k)
+        for (int i = 0; i < blocos; i++)
+        {
+            if (i == k) continue;
+            for (int j = 0; j < blocos; j++)
+                if (j != k) RelaxaBloco(ap, i, j, k);
+        }
+    }
+
+    // Uma distncia negativa de um vrtice at ele prprio indica um ciclo negativo
+    for (int u = 0; u < n && !ap->ciclo; u++)
+        ap->ciclo = ap->distancia[(size_t)u * L + u] < 0;
+
+    *res = true;
+    return ap;
+}
+
+
+/**
+ * @brief Calcula os caminhos mais curtos ou mais pesados entre todos os pares de vrtices do grafo.
+ *
+ * Congela o grafo (FreezeGraph) e usa AllPairsCSR; substitui uma chamada de BestPath
+ * por cada vrtice quando so precisos os caminhos a partir de todos os vrtices.
+ *
+ * @param g O apontador para o grafo.
+ * @param modo AP_MAIS_CURTO ou AP_MAIS_PESADO.
+ * @param res Apontador para um booleano que indica se a operao foi bem-sucedida.
+ * @return Um apontador para a estrutura criada, ou NULL em caso de erro.
+ */
+AllPairs* AllPairsGraph(Graph* g, int modo, bool* res)
+{
+    CSR* c = FreezeGraph(g, res);
+    if (!*res) return NULL;
+
+    AllPairs* ap = AllPairsCSR(c, modo, res);
+    bool ok;
+    DestroyCSR(c, &ok);
+    return ap;
+}
+
+
+/**
+ * @brief Devolve a posio de um vrtice nas matrizes (pesquisa binria nos IDs).
+ *
+ * @param ap A estrutura de caminhos entre todos os pares.
+ * @param id O ID do vrtice.
+ * @return A posio do vrtice, ou -1 se no existir.
+ */
+int IndexAllPairs(AllPairs* ap, int id)
+{
+    if (ap == NULL) return -1;
+
+    int inicio = 0, fim = ap->n - 1;
+    while (inicio <= fim)
+    {
+        int meio = inicio + (fim - inicio) / 2;
+        if (ap->ids[meio] == id) return meio;
+        if (ap->ids[meio] < id) inicio = meio + 1;
+        else fim = meio - 1;
+    }
+    return -1;
+}
+
+
+/**
+ * @brief Devolve a distncia do caminho mais curto (ou mais pesado) entre duas posies.
+ *
+ * @param ap A estrutura de caminhos entre todos os pares.
+ * @param i A posio do vrtice de origem.
+ * @param j A posio do vrtice de destino.
+ * @return A distncia, ou AP_SEM_CAMINHO se no houver caminho.
+ */
+long long DistanceAllPairs(AllPairs* ap, int i, int j)
+{
+    if (ap == NULL || i < 0 || j < 0 || i >= ap->n || j >= ap->n) return AP_SEM_CAMINHO;
+
+    long long d = ap->distancia[(size_t)i * ap->tamLinha + j];
+    if (d == AP_INFINITO) return AP_SEM_CAMINHO;
+    return (ap->modo == AP_MAIS_PESADO) ? -d : d;
+}
+
+
+/**
+ * @brief Reconstri o caminho entre duas posies a partir da matriz de antecessores.
+ *
+ * O caminho s  escrito se couber em max posies; caso contrrio, o valor devolvido
+ * indica o tamanho necessrio.
+ *
+ * @param ap A estrutura de caminhos entre todos os pares.
+ * @param i A posio do vrtice de origem.
+ * @param j A posio do vrtice de destino.
+ * @param caminho Vetor que recebe os IDs dos vrtices, da origem at ao destino.
+ * @param max Nmero de posies de caminho.
+ * @return O nmero de vrtices do caminho, ou 0 se no houver caminho (ou se passar por um ciclo).
+ */
+int PathAllPairs(AllPairs* ap, int i, int j, int* caminho, int max)
+{
+    if (DistanceAllPairs(ap, i, j) == AP_SEM_CAMINHO) return 0;
+
+    const int* anteriores = ap->anteriores + (size_t)i * ap->tamLinha;
+    int tam = 1;
+    for (int k = j; k != i; k = anteriores[k])
+    {
+        if (anteriores[k] < 0 || tam > ap->n) return 0; // Caminho interrompido por um ciclo
+        tam++;
+    }
+    if (tam > max || caminho == NULL) return tam;
+
+    int pos = tam;
+    for (int k = j; ; k = anteriores[k])
+    {
+        caminho[--pos] = ap->ids[k];
+        if (k == i) break;
+    }
+    return tam;
+}
+
+#pragma endregion
@@ -0,0 +1,67 @@
+/**
+ * @file   AllPairs.h
+ * @brief  Definies do clculo de caminhos entre todos os pares de vrtices (Floyd-Warshall).
+ *
+ * A matriz de distncias  construda uma nica vez a partir de uma estrutura CSR e o
+ * algoritmo de Floyd-Warshall  aplicado por blocos de AP_BLOCO x AP_BLOCO posies, para
+ * que as trs submatrizes usadas em cada passo caibam na cache. Dentro de cada bloco, as
+ * linhas so percorridas com instrues AVX2 (4 distncias de 64 bits de cada vez) quando o compilador
+ * as disponibiliza (__AVX2__), ou com um ciclo simples que o compilador pode vetorizar.
+ * H dois modos: caminhos mais curtos (min-plus) e caminhos mais pesados (max-plus);
+ * o segundo  calculado como o primeiro com os pesos de sinal trocado.
+ *
+ * @date   Outubro 2026
+ * @author Hugo Lopes_30516
+ */
+
+#pragma once
+
+#define _CRT_SECURE_NO_WARNINGS
+
+#ifndef ALLPAIRS_H
+#define ALLPAIRS_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <limits.h>
+#include "Graph.h"
+#include "CSR.h"
+
+/* Modos do clculo */
+#define AP_MAIS_CURTO 0     /* Caminhos com a menor soma de pesos */
+#define AP_MAIS_PESADO 1    /* Caminhos com a maior soma de pesos */
+
+/* Lado dos blocos do algoritmo (as linhas da matriz so arredondadas a um mltiplo) */
+#define AP_BLOCO 64
+
+/* Distncia devolvida quando no h caminho entre os dois vrtices */
+#define AP_SEM_CAMINHO LLONG_MIN
+
+/* Tamanho mximo (em bytes) de cada uma das duas matrizes */
+#define AP_MAX_BYTES ((size_t)1 << 31)
+
+ /**
+  * @brief Estrutura com as distncias e os antecessores entre todos os pares de vrtices.
+  *
+  * As matrizes so indexadas pelas posies dos vrtices na estrutura CSR (IDs por ordem
+  * crescente): a entrada (i, j) est em [i * tamLinha + j].
+  */
+typedef struct AllPairs
+{
+    int n;                  /* Nmero de vrtices */
+    int tamLinha;           /* Posies por linha das matrizes (n arredondado a AP_BLOCO) */
+    int modo;               /* AP_MAIS_CURTO ou AP_MAIS_PESADO */
+    bool ciclo;             /* H um ciclo negativo (mais curto) ou positivo (mais pesado) */
+    int* ids;               /* ID do vrtice de cada posio */
+    long long* distancia;   /* Distncia de i at j (com o sinal trocado em AP_MAIS_PESADO) */
+    int* anteriores;        /* Posio do antecessor de j no caminho de i at j (-1 se no houver) */
+} AllPairs;
+
+AllPairs* AllPairsCSR(CSR* c, int modo, bool* res);
+AllPairs* AllPairsGraph(Graph* g, int modo, bool* res);
+AllPairs* DestroyAllPairs(AllPairs* ap, bool* res);
+int IndexAllPairs(AllPairs* ap, int id);
+long long DistanceAllPairs(AllPairs* ap, int i, int j);
+int PathAllPairs(AllPairs* ap, int i, int j, int* caminho, int max);
+
+#endif /* ALLPAIRS_H */
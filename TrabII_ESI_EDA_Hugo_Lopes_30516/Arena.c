@@ -0,0 +1,133 @@
+/**
+ * @file   Arena.c
+ * @author Hugo Lopes_30516
+ *
+ * @brief Implementao do alocador por blocos (arena).
+ *
+ * @date   Outubro 2026
+ */
+
+#include <stdlib.h>
+#include <malloc.h>
+#include <stdbool.h>
+#include "Arena.h"
+
+/* Alinhamento dos objetos e do incio de cada bloco */
+#define ARENA_ALINHAMENTO 16
+
+
+#pragma region Inicializa uma arena.
+/**
+ * @brief Inicializa uma arena vazia (nenhum bloco  reservado at  primeira alocao).
+ *
+ * @param a Apontador para a arena a inicializar.
+ * @param tamanho O tamanho de cada objeto.
+ * @param porBloco O nmero de objetos do primeiro bloco (<= 0 usa ARENA_BLOCO).
+ * @return true se a arena foi inicializada; false se os parmetros forem invlidos.
+ */
+bool CreateArena(Arena* a, size_t tamanho, int porBloco)
+{
+    if (a == NULL || tamanho == 0) return false;
+
+    // Cada objeto tem de poder guardar o apontador da lista de livres
+    if (tamanho < sizeof(void*)) tamanho = sizeof(void*);
+    a->tamanho = (tamanho + sizeof(void*) - 1) / sizeof(void*) * sizeof(void*);
+
+    a->porBloco = (porBloco > 0) ? porBloco : ARENA_BLOCO;
+    if (a->porBloco > ARENA_BLOCO_MAX) a->porBloco = ARENA_BLOCO_MAX;
+    a->blocos = NULL;
+    a->cursor = NULL;
+    a->restantes = 0;
+    a->livres = NULL;
+    return true;
+}
+#pragma endregion
+
+
+#pragma region Reserva um objeto da arena.
+/**
+ * @brief Reserva um objeto da arena.
+ *
+ * Reutiliza primeiro os objetos devolvidos; se no houver, usa o bloco atual
+ * e, quando este se esgota, reserva um novo bloco com o dobro do tamanho.
+ *
+ * @param a Apontador para a arena.
+ * @return Um apontador para o objeto, ou NULL se a alocao de memria falhar.
+ */
+void* AllocArena(Arena* a)
+{
+    if (a == NULL) return NULL;
+
+    // Reutiliza um objeto devolvido
+    if (a->livres != NULL)
+    {
+        void* objeto = a->livres;
+        a->livres = *(void**)objeto;
+        return objeto;
+    }
+
+    // Reserva um novo bloco quando o atual se esgota
+    if (a->restantes == 0)
+    {
+        size_t cabecalho = (sizeof(BlocoArena) + ARENA_ALINHAMENTO - 1) / ARENA_ALINHAMENTO * ARENA_ALINHAMENTO;
+        BlocoArena* bloco = (BlocoArena*)malloc(cabecalho + a->tamanho * (size_t)a->porBloco);
+        if (bloco == NULL) return NULL;
+
+        bloco->next = a->blocos;
+        a->blocos = bloco;
+        a->cursor = (char*)bloco + cabecalho;
+        a->restantes = a->porBloco;
+
+        // O prximo bloco ter o dobro dos objetos
+        if (a->porBloco < ARENA_BLOCO_MAX) a->porBloco *= 2;
+    }
+
+    void* objeto = a->cursor;
+    a->cursor += a->tamanho;
+    a->restantes--;
+    return objeto;
+}
+#pragma endregion
+
+
+#pragma region Devolve um objeto  arena.
+/**
+ * @brief Devolve um objeto  arena para ser reutilizado na prxima alocao.
+ *
+ * @param a Apontador para a arena.
+ * @param objeto O objeto a devolver (reservado com AllocArena desta arena).
+ */
+void FreeArena(Arena* a, void* objeto)
+{
+    if (a == NULL || objeto == NULL) return;
+
+    *(void**)objeto = a->livres;
+    a->livres = objeto;
+}
+#pragma endregion
+
+
+#pragma region Liberta toda a memria da arena.
+/**
+ * @brief Liberta todos os blocos da arena (todos os objetos deixam de ser vlidos).
+ *
+ * @param a Apontador para a arena.
+ */
+void DestroyArena(Arena* a)
+{
+    if (a == NULL) return;
+
+    BlocoArena* bloco = a->blocos;
+    while (bloco != NULL)
+    {
+        BlocoArena* next = bloco->next;
+        free(bloco);
+        bloco = next;
+    }
+
+    a->blocos = NULL;
+    a->cursor = NULL;
+    a->restantes = 0;
+    a->livres = NULL;
+}
+#pragma endregion
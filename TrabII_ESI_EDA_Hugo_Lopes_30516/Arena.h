@@ -0,0 +1,54 @@
+/**
+ * @file   Arena.h
+ * @brief  Definies do alocador por blocos (arena) usado para vrtices, adjacncias e ns de leitura.
+ *
+ * Uma arena reserva memria em blocos com muitos objetos do mesmo tamanho, evitando um malloc
+ * por objeto. Os objetos libertados voltam a uma lista de livres e so reutilizados;
+ * toda a memria  devolvida de uma s vez, bloco a bloco, por DestroyArena.
+ *
+ * @date   Outubro 2026
+ * @author Hugo Lopes_30516
+ */
+
+#pragma once
+
+#define _CRT_SECURE_NO_WARNINGS
+
+#ifndef ARENA_H
+#define ARENA_H
+
+#include <stddef.h>
+#include <stdbool.h>
+
+/* Nmero de objetos do primeiro bloco de uma arena */
+#define ARENA_BLOCO 256
+/* Nmero mximo de objetos por bloco (os blocos duplicam at este limite) */
+#define ARENA_BLOCO_MAX 65536
+
+ /**
+  * @brief Cabealho de um bloco de memria da arena.
+  */
+typedef struct BlocoArena
+{
+    struct BlocoArena* next;
+} BlocoArena;
+
+/**
+ * @brief Estrutura para representar uma arena de objetos de tamanho fixo.
+ */
+typedef struct Arena
+{
+    size_t tamanho;         /* Tamanho de cada objeto (alinhado) */
+    int porBloco;           /* Nmero de objetos do prximo bloco */
+    BlocoArena* blocos;     /* Lista de blocos alocados */
+    char* cursor;           /* Prximo objeto por usar no bloco atual */
+    int restantes;          /* Objetos por usar no bloco atual */
+    void* livres;           /* Lista de objetos devolvidos  arena */
+} Arena;
+
+bool CreateArena(Arena* a, size_t tamanho, int porBloco);
+void* AllocArena(Arena* a);
+void FreeArena(Arena* a, void* objeto);
+void DestroyArena(Arena* a);
+
+#endif /* ARENA_H */
@@ -0,0 +1,608 @@
+/**
+ * @file   CSR.c
+ * @author Hugo Lopes_30516
+ *
+ * @brief Implementao da representao compacta (CSR) de um grafo.
+ *
+ * Este ficheiro contm a converso de um grafo em listas ligadas para vetores contguos
+ * e as verses dos algoritmos de procura, contagem de caminhos e caminho mais pesado
+ * que percorrem esses vetores sequencialmente.
+ *
+ * @date   Outubro 2026
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <malloc.h>
+#include <stdbool.h>
+#include <string.h>
+#include "Graph.h"
+#include "CSR.h"
+
+
+#pragma region Congela um grafo em formato CSR.
+/**
+ * @brief Cria uma cpia s de leitura do grafo em formato CSR.
+ *
+ * Os vrtices recebem ndices densos (0 .. numVertices-1) pela ordem da lista do grafo,
+ * que est ordenada por ID. As adjacncias para vrtices inexistentes so ignoradas.
+ *
+ * @param G O grafo a congelar.
+ * @param res Apontador para um booleano que indica se a operao foi bem-sucedida.
+ * @return Um apontador para a estrutura CSR criada, ou NULL em caso de erro.
+ */
+CSR* FreezeGraph(Graph* G, bool* res)
+{
+    *res = false;
+    if (G == NULL) return NULL;
+
+    CSR* c = (CSR*)calloc(1, sizeof(CSR));
+    if (c == NULL) return NULL;
+
+    // Os nmeros de vrtices e de adjacncias so mantidos pelo grafo
+    int numV = G->numeroVertices, numA = G->numArestas;
+
+    // Aloca os vetores (pelo menos uma posio, para evitar malloc(0))
+    c->offsets = (int*)malloc((numV + 1) * sizeof(int));
+    c->ids = (int*)malloc((numV > 0 ? numV : 1) * sizeof(int));
+    c->destinos = (int*)malloc((numA > 0 ? numA : 1) * sizeof(int));
+    c->pesos = (int*)malloc((numA > 0 ? numA : 1) * sizeof(int));
+    if (c->offsets == NULL || c->ids == NULL || c->destinos == NULL || c->pesos == NULL)
+    {
+        DestroyCSR(c, res);
+        *res = false;
+        return NULL;
+    }
+
+    // Preenche os IDs (j ordenados, pois a lista de vrtices  ordenada)
+    int k = 0;
+    for (Node* aux = G->inicioGraph; aux != NULL; aux = aux->nextVertice) c->ids[k++] = aux->id;
+    c->numVertices = numV;
+
+    // Segunda passagem: copia as adjacncias com os destinos convertidos em ndices
+    int pos = 0;
+    k = 0;
+    for (Node* aux = G->inicioGraph; aux != NULL; aux = aux->nextVertice)
+    {
+        c->offsets[k++] = pos;
+        for (Adjacent* adj = aux->nextAdjacent; adj != NULL; adj = adj->next)
+        {
+            int d = IndexCSR(c, adj->id);
+            if (d < 0) continue; // Destino inexistente
+
+            c->destinos[pos] = d;
+            c->pesos[pos] = adj->peso;
+            pos++;
+        }
+    }
+    c->offsets[numV] = pos;
+    c->numArestas = pos;
+
+    *res = true;
+    return c;
+}
+#pragma endregion
+
+
+#pragma region Cria uma estrutura CSR a partir de listas de arestas.
+/**
+ * @brief Cria uma estrutura CSR a partir de uma ou mais listas de arestas com ndices densos.
+ *
+ * As arestas so distribudas pelos vrtices de origem com uma ordenao por contagem estvel:
+ * as adjacncias de cada vrtice ficam pela ordem em que aparecem nas listas
+ * (partes[0], depois partes[1], ...).
+ *
+ * @param partes Vetor de listas de arestas (origens e destinos entre 0 e numVertices-1).
+ * @param numPartes O nmero de listas.
+ * @param numVertices O nmero de vrtices.
+ * @param ids O ID de cada vrtice, por ordem crescente, ou NULL para usar os prprios ndices como IDs.
+ * @param res Apontador para um booleano que indica se a operao foi bem-sucedida.
+ * @return Um apontador para a estrutura CSR criada, ou NULL se faltar memria ou houver
+ *         arestas com vrtices fora do intervalo.
+ */
+CSR* CreateCSRFromEdges(EdgeBuffer* partes, int numPartes, int numVertices, const int* ids, bool* res)
+{
+    *res = false;
+    if (numVertices < 0 || (numPartes > 0 && partes == NULL)) return NULL;
+
+    // Conta as arestas e verifica os ndices
+    int numA = 0;
+    for (int p = 0; p < numPartes; p++)
+    {
+        for (int e = 0; e < partes[p].numArestas; e++)
+        {
+            if ((unsigned)partes[p].origens[e] >= (unsigned)numVertices ||
+                (unsigned)partes[p].destinos[e] >= (unsigned)numVertices) return NULL;
+        }
+        numA += partes[p].numArestas;
+    }
+
+    CSR* c = (CSR*)calloc(1, sizeof(CSR));
+    if (c == NULL) return NULL;
+
+    c->offsets = (int*)calloc((size_t)numVertices + 1, sizeof(int));
+    c->ids = (int*)malloc((numVertices > 0 ? numVertices : 1) * sizeof(int));
+    c->destinos = (int*)malloc((numA > 0 ? numA : 1) * sizeof(int));
+    c->pesos = (int*)malloc((numA > 0 ? numA : 1) * sizeof(int));
+    int* cursor = (int*)malloc((numVertices > 0 ? numVertices : 1) * sizeof(int));
+    if (c->offsets == NULL || c->ids == NULL || c->destinos == NULL || c->pesos == NULL || cursor == NULL)
+    {
+        free(cursor);
+        DestroyCSR(c, res);
+        *res = false;
+        return NULL;
+    }
+    c->numVertices = numVertices;
+    c->numArestas = numA;
+    for (int k = 0; k < numVertices; k++) c->ids[k] = (ids != NULL) ? ids[k] : k;
+
+    // Grau de sada de cada vrtice e incio das suas adjacncias
+    for (int p = 0; p < numPartes; p++)
+        for (int e = 0; e < partes[p].numArestas; e++) c->offsets[partes[p].origens[e] + 1]++;
+    for (int k = 0; k < numVertices; k++) c->offsets[k + 1] += c->offsets[k];
+
+    // Coloca cada aresta na posio seguinte do seu vrtice de origem
+    for (int k = 0; k < numVertices; k++) cursor[k] = c->offsets[k];
+    for (int p = 0; p < numPartes; p++)
+    {
+        for (int e = 0; e < partes[p].numArestas; e++)
+        {
+            int pos = cursor[partes[p].origens[e]]++;
+            c->destinos[pos] = partes[p].destinos[e];
+            c->pesos[pos] = partes[p].pesos[e];
+        }
+    }
+
+    free(cursor);
+    *res = true;
+    return c;
+}
+#pragma endregion
+
+
+#pragma region Cria a estrutura CSR transposta.
+/**
+ * @brief Cria a estrutura CSR com as adjacncias invertidas (cada u -> w passa a w -> u).
+ *
+ * Os vrtices mantm os ndices e os IDs; as adjacncias de entrada de cada vrtice ficam
+ * por ordem crescente do ndice de origem. Serve para procuras que partem do destino
+ * (por exemplo, a procura bidirecional).
+ *
+ * @param c A estrutura CSR a transpor.
+ * @param res Apontador para um booleano que indica se a operao foi bem-sucedida.
+ * @return Um apontador para a estrutura CSR transposta, ou NULL em caso de erro.
+ */
+CSR* TransposeCSR(CSR* c, bool* res)
+{
+    *res = false;
+    if (c == NULL) return NULL;
+
+    int numV = c->numVertices, numA = c->numArestas;
+    CSR* t = (CSR*)calloc(1, sizeof(CSR));
+    if (t == NULL) return NULL;
+
+    t->offsets = (int*)calloc((size_t)numV + 1, sizeof(int));
+    t->ids = (int*)malloc((numV > 0 ? numV : 1) * sizeof(int));
+    t->destinos = (int*)malloc((numA > 0 ? numA : 1) * sizeof(int));
+    t->pesos = (int*)malloc((numA > 0 ? numA : 1) * sizeof(int));
+    int* cursor = (int*)malloc((numV > 0 ? numV : 1) * sizeof(int));
+    if (t->offsets == NULL || t->ids == NULL || t->destinos == NULL || t->pesos == NULL || cursor == NULL)
+    {
+        free(cursor);
+        DestroyCSR(t, res);
+        *res = false;
+        return NULL;
+    }
+    t->numVertices = numV;
+    t->numArestas = numA;
+    memcpy(t->ids, c->ids, numV * sizeof(int));
+
+    // Grau de entrada de cada vrtice e incio das suas adjacncias invertidas
+    for (int e = 0; e < numA; e++) t->offsets[c->destinos[e] + 1]++;
+    for (int k = 0; k < numV; k++) t->offsets[k + 1] += t->offsets[k];
+
+    // Percorre as origens por ordem crescente, pelo que cada lista fica ordenada
+    for (int k = 0; k < numV; k++) cursor[k] = t->offsets[k];
+    for (int u = 0; u < numV; u++)
+    {
+        for (int e = c->offsets[u]; e < c->offsets[u + 1]; e++)
+        {
+            int pos = cursor[c->destinos[e]]++;
+            t->destinos[pos] = u;
+            t->pesos[pos] = c->pesos[e];
+        }
+    }
+
+    free(cursor);
+    *res = true;
+    return t;
+}
+#pragma endregion
+
+
+#pragma region Liberta a memria de uma estrutura CSR.
+/**
+ * @brief Liberta a memria de uma estrutura CSR (ou desfaz o mapeamento, se foi aberta com OpenCSR).
+ *
+ * @param c A estrutura a libertar.
+ * @param res Apontador para um booleano que indica se a operao foi bem-sucedida.
+ * @return NULL (no h mais estrutura para apontar).
+ */
+CSR* DestroyCSR(CSR* c, bool* res)
+{
+    if (c == NULL)
+    {
+        *res = false;
+        return NULL;
+    }
+
+    if (c->mapa != NULL)
+    {
+        // Os vetores apontam para o ficheiro mapeado
+        CloseMapFile(c->mapa);
+        free(c->mapa);
+    }
+    else
+    {
+        free(c->offsets);
+        free(c->destinos);
+        free(c->pesos);
+        free(c->ids);
+    }
+    free(c);
+
+    *res = true;
+    return NULL;
+}
+#pragma endregion
+
+
+#pragma region Calcula as posies dos vetores no ficheiro CSR.
+/**
+ * @brief Calcula a posio de cada vetor no ficheiro CSR e o tamanho total do ficheiro.
+ *
+ * @param numVertices O nmero de vrtices.
+ * @param numArestas O nmero de adjacncias.
+ * @param posicoes Vetor que recebe as posies de offsets, ids, destinos e pesos (por esta ordem).
+ * @return O tamanho do ficheiro em bytes.
+ */
+static size_t PosicoesFicheiroCSR(int numVertices, int numArestas, size_t posicoes[4])
+{
+    size_t tamanhos[4] = {
+        ((size_t)numVertices + 1) * sizeof(int),
+        (size_t)numVertices * sizeof(int),
+        (size_t)numArestas * sizeof(int),
+        (size_t)numArestas * sizeof(int)
+    };
+
+    size_t pos = CSRFILE_ALINHAMENTO; // O cabealho ocupa o primeiro bloco
+    for (int i = 0; i < 4; i++)
+    {
+        posicoes[i] = pos;
+        pos += (tamanhos[i] + CSRFILE_ALINHAMENTO - 1) / CSRFILE_ALINHAMENTO * CSRFILE_ALINHAMENTO;
+    }
+    return pos;
+}
+#pragma endregion
+
+
+#pragma region Guarda uma estrutura CSR num ficheiro.
+/**
+ * @brief Guarda uma estrutura CSR num ficheiro com o mesmo formato dos vetores em memria,
+ *        para poder ser aberta com OpenCSR sem converses.
+ *
+ * @param c A estrutura CSR.
+ * @param ficheiro O nome do ficheiro.
+ * @return true se o ficheiro foi escrito; false caso contrrio.
+ */
+bool SaveCSR(CSR* c, const char* ficheiro)
+{
+    if (c == NULL) return false;
+
+    FILE* fp = fopen(ficheiro, "wb");
+    if (fp == NULL) return false;
+
+    // Bloco a zeros usado para o cabealho e para o enchimento entre vetores
+    char bloco[CSRFILE_ALINHAMENTO] = { 0 };
+    CSRFileHeader cab;
+    memcpy(cab.magico, CSRFILE_MAGICO, sizeof(cab.magico));
+    cab.versao = CSRFILE_VERSAO;
+    cab.numVertices = c->numVertices;
+    cab.numArestas = c->numArestas;
+    memcpy(bloco, &cab, sizeof(cab));
+    bool ok = fwrite(bloco, 1, sizeof(bloco), fp) == sizeof(bloco);
+    memset(bloco, 0, sizeof(bloco));
+
+    size_t posicoes[4];
+    size_t total = PosicoesFicheiroCSR(c->numVertices, c->numArestas, posicoes);
+    const int* vetores[4] = { c->offsets, c->ids, c->destinos, c->pesos };
+    size_t numeros[4] = { (size_t)c->numVertices + 1, (size_t)c->numVertices, (size_t)c->numArestas, (size_t)c->numArestas };
+    for (int i = 0; ok && i < 4; i++)
+    {
+        ok = fwrite(vetores[i], sizeof(int), numeros[i], fp) == numeros[i];
+
+        // Enchimento at ao incio do vetor seguinte
+        size_t fim = posicoes[i] + numeros[i] * sizeof(int);
+        size_t seguinte = (i < 3) ? posicoes[i + 1] : total;
+        if (ok && seguinte > fim) ok = fwrite(bloco, 1, seguinte - fim, fp) == seguinte - fim;
+    }
+
+    if (fclose(fp) != 0) ok = false;
+    return ok;
+}
+#pragma endregion
+
+
+#pragma region Abre uma estrutura CSR guardada num ficheiro, sem a copiar.
+/**
+ * @brief Abre um ficheiro escrito por SaveCSR mapeando-o em memria.
+ *
+ * Os vetores da estrutura apontam diretamente para o ficheiro mapeado: no h leitura
+ * nem converso dos dados, e as pginas s so carregadas quando so consultadas
+ * (e so partilhadas por todos os processos que abrem o mesmo ficheiro). Por isso,
+ * a estrutura  s de leitura e o ficheiro no  validado alm do cabealho,
+ * do tamanho e dos limites de offsets; deve ser libertada com DestroyCSR.
+ *
+ * @param ficheiro O nome do ficheiro.
+ * @param res Apontador para um booleano que indica se a operao foi bem-sucedida.
+ * @return Um apontador para a estrutura CSR, ou NULL se o ficheiro no existir ou no for vlido.
+ */
+CSR* OpenCSR(const char* ficheiro, bool* res)
+{
+    *res = false;
+
+    CSR* c = (CSR*)calloc(1, sizeof(CSR));
+    MapFile* mapa = (MapFile*)malloc(sizeof(MapFile));
+    if (c == NULL || mapa == NULL || !OpenMapFile(mapa, ficheiro))
+    {
+        free(c);
+        free(mapa);
+        return NULL;
+    }
+    c->mapa = mapa;
+
+    // Valida o cabealho e o tamanho do ficheiro
+    CSRFileHeader cab;
+    size_t posicoes[4];
+    if (mapa->tamanho >= CSRFILE_ALINHAMENTO) memcpy(&cab, mapa->dados, sizeof(cab));
+    if (mapa->tamanho < CSRFILE_ALINHAMENTO ||
+        memcmp(cab.magico, CSRFILE_MAGICO, sizeof(cab.magico)) != 0 || cab.versao != CSRFILE_VERSAO ||
+        cab.numVertices < 0 || cab.numArestas < 0 ||
+        PosicoesFicheiroCSR(cab.numVertices, cab.numArestas, posicoes) != mapa->tamanho)
+    {
+        DestroyCSR(c, res);
+        *res = false;
+        return NULL;
+    }
+
+    // Os vetores comeam em posies alinhadas do mapeamento (que comea numa pgina)
+    c->numVertices = cab.numVertices;
+    c->numArestas = cab.numArestas;
+    c->offsets = (int*)(mapa->dados + posicoes[0]);
+    c->ids = (int*)(mapa->dados + posicoes[1]);
+    c->destinos = (int*)(mapa->dados + posicoes[2]);
+    c->pesos = (int*)(mapa->dados + posicoes[3]);
+    if (c->offsets[0] != 0 || c->offsets[c->numVertices] != c->numArestas)
+    {
+        DestroyCSR(c, res);
+        *res = false;
+        return NULL;
+    }
+
+    // As consultas acedem a posies arbitrrias dos vetores
+    AdviseMapFile(mapa, false);
+
+    *res = true;
+    return c;
+}
+#pragma endregion
+
+
+#pragma region Converte um ID de vrtice no seu ndice denso.
+/**
+ * @brief Converte um ID de vrtice no seu ndice denso (pesquisa binria nos IDs ordenados).
+ *
+ * @param c A estrutura CSR.
+ * @param id O ID do vrtice.
+ * @return O ndice do vrtice, ou -1 se no existir.
+ */
+int IndexCSR(CSR* c, int id)
+{
+    if (c == NULL) return -1;
+
+    int inf = 0, sup = c->numVertices - 1;
+    while (inf <= sup)
+    {
+        int meio = inf + (sup - inf) / 2;
+        if (c->ids[meio] == id) return meio;
+        if (c->ids[meio] < id) inf = meio + 1;
+        else sup = meio - 1;
+    }
+    return -1;
+}
+#pragma endregion
+
+
+#pragma region ALGORITMOS
+
+/**
+ * @brief Busca em Profundidade sobre a estrutura CSR.
+ *
+ * Equivalente a DepthFirstSearchRec, mas o estado "visitado"  guardado num vetor
+ * prprio da consulta, pelo que no  preciso reiniciar o grafo. A procura  iterativa:
+ * os vrtices marcados e ainda por expandir ficam numa pilha explcita (cada vrtice entra
+ * uma nica vez), pelo que no depende da profundidade do grafo.
+ *
+ * @param c A estrutura CSR.
+ * @param origem O ID do vrtice de origem.
+ * @param dest O ID do vrtice de destino.
+ * @return Retorna true se existir um caminho entre os vrtices de origem e destino, false caso contrrio.
+ */
+bool DepthFirstSearchCSR(CSR* c, int origem, int dest)
+{
+    if (origem == dest) return true; // Retorna true se a origem for igual ao destino
+
+    int s = IndexCSR(c, origem);
+    int d = IndexCSR(c, dest);
+    if (s < 0 || d < 0) return false;
+
+    char* visitados = (char*)calloc(c->numVertices, sizeof(char));
+    int* pilha = (int*)malloc(c->numVertices * sizeof(int));
+    bool existe = false;
+
+    if (visitados != NULL && pilha != NULL)
+    {
+        visitados[s] = 1;
+        pilha[0] = s;
+        int topo = 1;
+        while (topo > 0 && !existe)
+        {
+            int u = pilha[--topo];
+            for (int e = c->offsets[u]; e < c->offsets[u + 1]; e++)
+            {
+                int w = c->destinos[e];
+                if (visitados[w]) continue;
+                if (w == d)
+                {
+                    existe = true;
+                    break;
+                }
+                visitados[w] = 1;
+                pilha[topo++] = w;
+            }
+        }
+    }
+
+    free(visitados);
+    free(pilha);
+    return existe;
+}
+
+
+/**
+ * @brief Conta o nmero de caminhos simples entre dois vrtices sobre a estrutura CSR.
+ *
+ * Equivalente a CountPathsVertices. O caminho atual fica numa pilha explcita, com a prxima
+ * adjacncia a seguir em cada vrtice do caminho.
+ *
+ * @param c A estrutura CSR.
+ * @param src O ID do vrtice de origem.
+ * @param dst O ID do vrtice de destino.
+ * @return O nmero total de caminhos entre os vrtices de origem e destino.
+ */
+int CountPathsCSR(CSR* c, int src, int dst)
+{
+    if (c == NULL) return 0;
+    if (src == dst) return 1;
+
+    int s = IndexCSR(c, src);
+    int d = IndexCSR(c, dst);
+    if (s < 0 || d < 0) return 0;
+
+    char* visitados = (char*)calloc(c->numVertices, sizeof(char));
+    int* pilha = (int*)malloc(c->numVertices * sizeof(int));
+    int* cursores = (int*)malloc(c->numVertices * sizeof(int));
+    int total = 0;
+
+    if (visitados != NULL && pilha != NULL && cursores != NULL)
+    {
+        visitados[s] = 1;
+        pilha[0] = s;
+        cursores[0] = c->offsets[s];
+        int topo = 1;
+        while (topo > 0)
+        {
+            int u = pilha[topo - 1];
+            if (cursores[topo - 1] == c->offsets[u + 1])
+            {
+                visitados[u] = 0; // Desmarca o vrtice para permitir outros caminhos
+                topo--;
+                continue;
+            }
+
+            int w = c->destinos[cursores[topo - 1]++];
+            if (visitados[w]) continue;
+            if (w == d)
+            {
+                total++;
+                continue;
+            }
+            visitados[w] = 1;
+            pilha[topo] = w;
+            cursores[topo++] = c->offsets[w];
+        }
+    }
+
+    free(visitados);
+    free(pilha);
+    free(cursores);
+    return total;
+}
+
+
+/**
+ * @brief Caminho mais pesado a partir de um vrtice, sobre a estrutura CSR.
+ *
+ * Segue a mesma seleo gulosa de BestPath, com a mesma fila de prioridade (DHeap) e a mesma
+ * ordem de desempate, em O((V + E) log V). Os resultados so indexados pelo ndice denso
+ * dos vrtices (c->ids[k] d o ID do vrtice k); os vrtices inalcanveis ficam com
+ * distncia MAXDISTANCE e antecessor igual ao vrtice inicial.
+ *
+ * @param c A estrutura CSR.
+ * @param v O ID do vrtice inicial.
+ * @param anteriores Vetor (numVertices posies) onde so guardados os antecessores.
+ * @param distance Vetor (numVertices posies) onde so guardados os pesos acumulados.
+ * @return true se o clculo foi feito; false se o vrtice no existir ou faltar memria.
+ */
+bool BestPathCSR(CSR* c, int v, int* anteriores, int* distance)
+{
+    if (c == NULL || anteriores == NULL || distance == NULL) return false;
+
+    int s = IndexCSR(c, v);
+    if (s < 0) return false;
+
+    int n = c->numVertices;
+    char* visitados = (char*)calloc(n, sizeof(char));
+    DHeap fila;
+    if (visitados == NULL || !CreateDHeap(&fila, n))
+    {
+        free(visitados);
+        return false;
+    }
+
+    // Inicializa distance e anteriores
+    for (int i = 0; i < n; i++)
+    {
+        distance[i] = MAXDISTANCE;
+        anteriores[i] = s;
+    }
+    distance[s] = 0;
+
+    // A fila retira primeiro a menor chave: a chave  o peso acumulado com o sinal trocado
+    PushDHeap(&fila, s, 0);
+
+    int atual;
+    while ((atual = PopDHeap(&fila, NULL)) >= 0)
+    {
+        // Fixa o vrtice por visitar com maior peso acumulado
+        visitados[atual] = 1;
+
+        // Relaxa as adjacncias do vrtice selecionado
+        for (int e = c->offsets[atual]; e < c->offsets[atual + 1]; e++)
+        {
+            int w = c->destinos[e];
+            if (!visitados[w] && distance[atual] + c->pesos[e] > distance[w])
+            {
+                distance[w] = distance[atual] + c->pesos[e];
+                anteriores[w] = atual;
+                PushDHeap(&fila, w, -(long long)distance[w]);
+            }
+        }
+    }
+
+    DestroyDHeap(&fila);
+    free(visitados);
+    return true;
+}
+
+#pragma endregion
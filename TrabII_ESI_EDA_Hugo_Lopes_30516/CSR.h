@@ -0,0 +1,73 @@
+/**
+ * @file   CSR.h
+ * @brief  Definies da representao compacta (CSR) de um grafo e prottipos das funes de consulta.
+ *
+ * Um grafo "congelado" guarda todas as adjacncias em vetores contguos
+ * (compressed sparse row): para o vrtice de ndice k, as suas adjacncias esto
+ * nas posies offsets[k] .. offsets[k+1]-1 dos vetores destinos e pesos.
+ * Os vrtices so numerados de 0 a numVertices-1 por ordem crescente de ID.
+ *
+ * @date   Outubro 2026
+ * @author Hugo Lopes_30516
+ */
+
+#pragma once
+
+#define _CRT_SECURE_NO_WARNINGS
+
+#ifndef CSR_H
+#define CSR_H
+
+#include <stdbool.h>
+#include "Graph.h"
+#include "EdgeList.h"
+#include "MapFile.h"
+
+/* Identificao e verso do ficheiro com uma estrutura CSR (SaveCSR / OpenCSR) */
+#define CSRFILE_MAGICO "CSRB"
+#define CSRFILE_VERSAO 1
+
+/* Alinhamento (em bytes) do cabealho e de cada vetor no ficheiro */
+#define CSRFILE_ALINHAMENTO 64
+
+ /**
+  * @brief Cabealho do ficheiro com uma estrutura CSR.
+  *
+  * Ocupa CSRFILE_ALINHAMENTO bytes e  seguido dos vetores offsets (numVertices + 1 inteiros),
+  * ids (numVertices), destinos (numArestas) e pesos (numArestas), cada um a comear numa
+  * posio mltipla de CSRFILE_ALINHAMENTO. Os inteiros esto na ordem de bytes da mquina.
+  */
+typedef struct
+{
+    char magico[4];     /* CSRFILE_MAGICO, sem o '\0' */
+    int versao;         /* CSRFILE_VERSAO */
+    int numVertices;    /* Nmero de vrtices */
+    int numArestas;     /* Nmero de adjacncias */
+} CSRFileHeader;
+
+ /**
+  * @brief Estrutura para representar um grafo s de leitura em formato CSR.
+  */
+typedef struct CSR
+{
+    int numVertices;    /* Nmero de vrtices */
+    int numArestas;     /* Nmero de adjacncias */
+    int* offsets;       /* Incio das adjacncias de cada vrtice (numVertices + 1 posies) */
+    int* destinos;      /* ndice do vrtice de destino de cada adjacncia */
+    int* pesos;         /* Peso de cada adjacncia */
+    int* ids;           /* ID de cada vrtice (ordenado por ordem crescente) */
+    MapFile* mapa;      /* Ficheiro de onde os vetores so lidos diretamente (OpenCSR), ou NULL se foram alocados */
+} CSR;
+
+CSR* FreezeGraph(Graph* G, bool* res);
+CSR* CreateCSRFromEdges(EdgeBuffer* partes, int numPartes, int numVertices, const int* ids, bool* res);
+CSR* TransposeCSR(CSR* c, bool* res);
+CSR* DestroyCSR(CSR* c, bool* res);
+bool SaveCSR(CSR* c, const char* ficheiro);
+CSR* OpenCSR(const char* ficheiro, bool* res);
+int IndexCSR(CSR* c, int id);
+bool DepthFirstSearchCSR(CSR* c, int origem, int dest);
+int CountPathsCSR(CSR* c, int src, int dst);
+bool BestPathCSR(CSR* c, int v, int* anteriores, int* distance);
+
+#endif /* CSR_H */
@@ -0,0 +1,493 @@
+/**
+ * @file   CompactGraph.c
+ * @author Hugo Lopes_30516
+ *
+ * @brief Implementao da representao comprimida das adjacncias de um grafo.
+ *
+ * Este ficheiro contm a compresso de uma estrutura CSR (destinos ordenados e codificados
+ * por diferenas em inteiros de tamanho varivel, pesos num vetor separado) e as verses
+ * dos algoritmos de procura, contagem de caminhos e caminho mais pesado que descodificam
+ * as adjacncias  medida que as percorrem.
+ *
+ * @date   Outubro 2026
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <malloc.h>
+#include <stdbool.h>
+#include "Graph.h"
+#include "CSR.h"
+#include "CompactGraph.h"
+
+
+ /**
+  * @brief Vetor de bytes que cresce por duplicao (usado durante a compresso).
+  */
+typedef struct
+{
+    unsigned char* dados;
+    size_t tamanho;
+    size_t capacidade;
+} VetorBytes;
+
+ /**
+  * @brief Adjacncia (destino e peso) usada para ordenar as adjacncias de um vrtice.
+  */
+typedef struct
+{
+    int destino;
+    int peso;
+} AdjCompact;
+
+
+#pragma region Escreve um inteiro de tamanho varivel.
+/**
+ * @brief Acrescenta um inteiro sem sinal ao vetor, 7 bits por byte (o bit mais alto indica que h mais bytes).
+ *
+ * @param v O vetor de bytes.
+ * @param valor O valor a escrever.
+ * @return true se o valor foi escrito; false se faltar memria.
+ */
+static bool EscreveVarint(VetorBytes* v, unsigned int valor)
+{
+    // Um inteiro de 32 bits ocupa no mximo 5 bytes
+    if (v->tamanho + 5 > v->capacidade)
+    {
+        size_t novaCap = (v->capacidade > 0) ? v->capacidade * 2 : 1024;
+        unsigned char* novo = (unsigned char*)realloc(v->dados, novaCap);
+        if (novo == NULL) return false;
+        v->dados = novo;
+        v->capacidade = novaCap;
+    }
+
+    while (valor >= 0x80)
+    {
+        v->dados[v->tamanho++] = (unsigned char)(valor | 0x80);
+        valor >>= 7;
+    }
+    v->dados[v->tamanho++] = (unsigned char)valor;
+    return true;
+}
+#pragma endregion
+
+
+#pragma region L um inteiro de tamanho varivel.
+/**
+ * @brief L um inteiro sem sinal escrito por EscreveVarint e avana o apontador.
+ */
+static unsigned int LeVarint(const unsigned char** p)
+{
+    const unsigned char* q = *p;
+    unsigned int valor = *q & 0x7F;
+    int desloc = 7;
+    while (*q++ & 0x80)
+    {
+        valor |= (unsigned int)(*q & 0x7F) << desloc;
+        desloc += 7;
+    }
+    *p = q;
+    return valor;
+}
+#pragma endregion
+
+
+#pragma region Compara duas adjacncias pelo destino (para qsort).
+/**
+ * @brief Compara duas adjacncias pelo destino e, em caso de empate, pelo peso.
+ */
+static int ComparaAdjCompact(const void* a, const void* b)
+{
+    const AdjCompact* x = (const AdjCompact*)a;
+    const AdjCompact* y = (const AdjCompact*)b;
+    if (x->destino != y->destino) return (x->destino > y->destino) - (x->destino < y->destino);
+    return (x->peso > y->peso) - (x->peso < y->peso);
+}
+#pragma endregion
+
+
+#pragma region Comprime uma estrutura CSR.
+/**
+ * @brief Cria a representao comprimida de uma estrutura CSR.
+ *
+ * As adjacncias de cada vrtice so ordenadas por destino; o primeiro destino  guardado
+ * tal como est e os seguintes como a diferena para o anterior, o que d um ou dois bytes
+ * por adjacncia na maior parte dos grafos. Os pesos so guardados com o sinal no bit menos
+ * significativo ((p << 1) ^ (p >> 31)), para que pesos pequenos negativos tambm ocupem um byte.
+ *
+ * @param c A estrutura CSR (no  alterada).
+ * @param res Apontador para um booleano que indica se a operao foi bem-sucedida.
+ * @return Um apontador para o grafo comprimido, ou NULL se faltar memria.
+ */
+CompactGraph* CompressCSR(CSR* c, bool* res)
+{
+    *res = false;
+    if (c == NULL) return NULL;
+
+    CompactGraph* g = (CompactGraph*)calloc(1, sizeof(CompactGraph));
+    if (g == NULL) return NULL;
+
+    int n = c->numVertices;
+    g->posicoes = (size_t*)malloc(((size_t)n + 1) * sizeof(size_t));
+    g->posicoesPesos = (size_t*)malloc(((size_t)n + 1) * sizeof(size_t));
+    g->ids = (int*)malloc((n > 0 ? n : 1) * sizeof(int));
+
+    // Vetor auxiliar para ordenar as adjacncias do vrtice com mais adjacncias
+    int maxGrau = 0;
+    for (int k = 0; k < n; k++)
+    {
+        int grau = c->offsets[k + 1] - c->offsets[k];
+        if (grau > maxGrau) maxGrau = grau;
+    }
+    AdjCompact* aux = (AdjCompact*)malloc((maxGrau > 0 ? maxGrau : 1) * sizeof(AdjCompact));
+
+    VetorBytes destinos = { NULL, 0, 0 };
+    VetorBytes pesos = { NULL, 0, 0 };
+    bool ok = (g->posicoes != NULL && g->posicoesPesos != NULL && g->ids != NULL && aux != NULL);
+    if (ok) memcpy(g->ids, c->ids, n * sizeof(int));
+
+    for (int k = 0; ok && k < n; k++)
+    {
+        g->posicoes[k] = destinos.tamanho;
+        g->posicoesPesos[k] = pesos.tamanho;
+
+        // Copia e ordena as adjacncias do vrtice
+        int grau = 0;
+        for (int e = c->offsets[k]; e < c->offsets[k + 1]; e++)
+        {
+            aux[grau].destino = c->destinos[e];
+            aux[grau].peso = c->pesos[e];
+            grau++;
+        }
+        if (grau > 1) qsort(aux, grau, sizeof(AdjCompact), ComparaAdjCompact);
+
+        // Nmero de adjacncias, seguido das diferenas entre destinos e dos pesos
+        ok = EscreveVarint(&destinos, (unsigned int)grau);
+        int anterior = 0;
+        for (int i = 0; ok && i < grau; i++)
+        {
+            ok = EscreveVarint(&destinos, (unsigned int)(aux[i].destino - anterior)) &&
+                 EscreveVarint(&pesos, ((unsigned int)aux[i].peso << 1) ^ (unsigned int)(aux[i].peso >> 31));
+            anterior = aux[i].destino;
+        }
+    }
+    free(aux);
+
+    if (!ok)
+    {
+        free(destinos.dados);
+        free(pesos.dados);
+        DestroyCompactGraph(g, res);
+        *res = false;
+        return NULL;
+    }
+
+    g->posicoes[n] = destinos.tamanho;
+    g->posicoesPesos[n] = pesos.tamanho;
+    g->numVertices = n;
+    g->numArestas = c->numArestas;
+
+    // Liberta a capacidade no usada dos vetores de bytes
+    g->destinos = (unsigned char*)realloc(destinos.dados, destinos.tamanho > 0 ? destinos.tamanho : 1);
+    if (g->destinos == NULL) g->destinos = destinos.dados;
+    g->pesos = (unsigned char*)realloc(pesos.dados, pesos.tamanho > 0 ? pesos.tamanho : 1);
+    if (g->pesos == NULL) g->pesos = pesos.dados;
+
+    *res = true;
+    return g;
+}
+#pragma endregion
+
+
+#pragma region Liberta a memria de um grafo comprimido.
+/**
+ * @brief Liberta a memria de um grafo comprimido.
+ *
+ * @param g O grafo a libertar.
+ * @param res Apontador para um booleano que indica se a operao foi bem-sucedida.
+ * @return NULL (no h mais estrutura para apontar).
+ */
+CompactGraph* DestroyCompactGraph(CompactGraph* g, bool* res)
+{
+    if (g == NULL)
+    {
+        *res = false;
+        return NULL;
+    }
+
+    free(g->posicoes);
+    free(g->posicoesPesos);
+    free(g->destinos);
+    free(g->pesos);
+    free(g->ids);
+    free(g);
+
+    *res = true;
+    return NULL;
+}
+#pragma endregion
+
+
+#pragma region Calcula a memria ocupada por um grafo comprimido.
+/**
+ * @brief Calcula o nmero de bytes ocupados pelos vetores de um grafo comprimido.
+ *
+ * @param g O grafo comprimido.
+ * @return O nmero de bytes (0 se g for NULL).
+ */
+size_t SizeCompactGraph(CompactGraph* g)
+{
+    if (g == NULL) return 0;
+
+    size_t n = (size_t)g->numVertices;
+    return sizeof(CompactGraph) + 2 * (n + 1) * sizeof(size_t) + n * sizeof(int) +
+           g->posicoes[n] + g->posicoesPesos[n];
+}
+#pragma endregion
+
+
+#pragma region Converte um ID de vrtice no seu ndice denso.
+/**
+ * @brief Converte um ID de vrtice no seu ndice denso (pesquisa binria nos IDs ordenados).
+ *
+ * @param g O grafo comprimido.
+ * @param id O ID do vrtice.
+ * @return O ndice do vrtice, ou -1 se no existir.
+ */
+int IndexCompact(CompactGraph* g, int id)
+{
+    if (g == NULL) return -1;
+
+    int inf = 0, sup = g->numVertices - 1;
+    while (inf <= sup)
+    {
+        int meio = inf + (sup - inf) / 2;
+        if (g->ids[meio] == id) return meio;
+        if (g->ids[meio] < id) inf = meio + 1;
+        else sup = meio - 1;
+    }
+    return -1;
+}
+#pragma endregion
+
+
+#pragma region Comea a percorrer as adjacncias de um vrtice.
+/**
+ * @brief Posiciona o cursor no incio das adjacncias do vrtice de ndice u.
+ *
+ * @param g O grafo comprimido.
+ * @param u O ndice do vrtice.
+ * @param cur O cursor a inicializar.
+ */
+void BeginAdjCompact(CompactGraph* g, int u, CursorCompact* cur)
+{
+    cur->destinos = g->destinos + g->posicoes[u];
+    cur->pesos = g->pesos + g->posicoesPesos[u];
+    cur->restantes = (int)LeVarint(&cur->destinos);
+    cur->destino = 0;
+}
+#pragma endregion
+
+
+#pragma region L a prxima adjacncia de um vrtice.
+/**
+ * @brief Descodifica a prxima adjacncia do cursor.
+ *
+ * @param cur O cursor (criado com BeginAdjCompact).
+ * @param destino Apontador que recebe o ndice do vrtice de destino.
+ * @param peso Apontador que recebe o peso da adjacncia.
+ * @return true se foi lida uma adjacncia; false se j no h mais.
+ */
+bool NextAdjCompact(CursorCompact* cur, int* destino, int* peso)
+{
+    if (cur->restantes == 0) return false;
+    cur->restantes--;
+
+    cur->destino += (int)LeVarint(&cur->destinos);
+    unsigned int p = LeVarint(&cur->pesos);
+
+    *destino = cur->destino;
+    *peso = (int)(p >> 1) ^ -(int)(p & 1);
+    return true;
+}
+#pragma endregion
+
+
+#pragma region ALGORITMOS
+
+/**
+ * @brief Busca em Profundidade sobre o grafo comprimido.
+ *
+ * Equivalente a DepthFirstSearchCSR (iterativa, com uma pilha explcita).
+ *
+ * @param g O grafo comprimido.
+ * @param origem O ID do vrtice de origem.
+ * @param dest O ID do vrtice de destino.
+ * @return Retorna true se existir um caminho entre os vrtices de origem e destino, false caso contrrio.
+ */
+bool DepthFirstSearchCompact(CompactGraph* g, int origem, int dest)
+{
+    if (origem == dest) return true; // Retorna true se a origem for igual ao destino
+
+    int s = IndexCompact(g, origem);
+    int d = IndexCompact(g, dest);
+    if (s < 0 || d < 0) return false;
+
+    char* visitados = (char*)calloc(g->numVertices, sizeof(char));
+    int* pilha = (int*)malloc(g->numVertices * sizeof(int));
+    bool existe = false;
+
+    if (visitados != NULL && pilha != NULL)
+    {
+        visitados[s] = 1;
+        pilha[0] = s;
+        int topo = 1;
+        while (topo > 0 && !existe)
+        {
+            CursorCompact cur;
+            int w, peso;
+            BeginAdjCompact(g, pilha[--topo], &cur);
+            while (NextAdjCompact(&cur, &w, &peso))
+            {
+                if (visitados[w]) continue;
+                if (w == d)
+                {
+                    existe = true;
+                    break;
+                }
+                visitados[w] = 1;
+                pilha[topo++] = w;
+            }
+        }
+    }
+
+    free(visitados);
+    free(pilha);
+    return existe;
+}
+
+
+/**
+ * @brief Conta o nmero de caminhos simples entre dois vrtices sobre o grafo comprimido.
+ *
+ * Equivalente a CountPathsCSR: cada vrtice do caminho atual guarda o seu cursor de adjacncias.
+ *
+ * @param g O grafo comprimido.
+ * @param src O ID do vrtice de origem.
+ * @param dst O ID do vrtice de destino.
+ * @return O nmero total de caminhos entre os vrtices de origem e destino.
+ */
+int CountPathsCompact(CompactGraph* g, int src, int dst)
+{
+    if (g == NULL) return 0;
+    if (src == dst) return 1;
+
+    int s = IndexCompact(g, src);
+    int d = IndexCompact(g, dst);
+    if (s < 0 || d < 0) return 0;
+
+    char* visitados = (char*)calloc(g->numVertices, sizeof(char));
+    int* pilha = (int*)malloc(g->numVertices * sizeof(int));
+    CursorCompact* cursores = (CursorCompact*)malloc(g->numVertices * sizeof(CursorCompact));
+    int total = 0;
+
+    if (visitados != NULL && pilha != NULL && cursores != NULL)
+    {
+        visitados[s] = 1;
+        pilha[0] = s;
+        BeginAdjCompact(g, s, &cursores[0]);
+        int topo = 1;
+        while (topo > 0)
+        {
+            int w, peso;
+            if (!NextAdjCompact(&cursores[topo - 1], &w, &peso))
+            {
+                visitados[pilha[--topo]] = 0; // Desmarca o vrtice para permitir outros caminhos
+                continue;
+            }
+            if (visitados[w]) continue;
+            if (w == d)
+            {
+                total++;
+                continue;
+            }
+            visitados[w] = 1;
+            pilha[topo] = w;
+            BeginAdjCompact(g, w, &cursores[topo++]);
+        }
+    }
+
+    free(visitados);
+    free(pilha);
+    free(cursores);
+    return total;
+}
+
+
+/**
+ * @brief Caminho mais pesado a partir de um vrtice, sobre o grafo comprimido.
+ *
+ * Equivalente a BestPathCSR: os resultados so indexados pelo ndice denso dos vrtices
+ * (g->ids[k] d o ID do vrtice k) e os vrtices inalcanveis ficam com distncia
+ * MAXDISTANCE e antecessor igual ao vrtice inicial.
+ *
+ * @param g O grafo comprimido.
+ * @param v O ID do vrtice inicial.
+ * @param anteriores Vetor (numVertices posies) onde so guardados os antecessores.
+ * @param distance Vetor (numVertices posies) onde so guardados os pesos acumulados.
+ * @return true se o clculo foi feito; false se o vrtice no existir ou faltar memria.
+ */
+bool BestPathCompact(CompactGraph* g, int v, int* anteriores, int* distance)
+{
+    if (g == NULL || anteriores == NULL || distance == NULL) return false;
+
+    int s = IndexCompact(g, v);
+    if (s < 0) return false;
+
+    int n = g->numVertices;
+    char* visitados = (char*)calloc(n, sizeof(char));
+    DHeap fila;
+    if (visitados == NULL || !CreateDHeap(&fila, n))
+    {
+        free(visitados);
+        return false;
+    }
+
+    // Inicializa distance e anteriores
+    for (int i = 0; i < n; i++)
+    {
+        distance[i] = MAXDISTANCE;
+        anteriores[i] = s;
+    }
+    distance[s] = 0;
+
+    // A fila retira primeiro a menor chave: a chave  o peso acumulado com o sinal trocado
+    PushDHeap(&fila, s, 0);
+
+    int atual;
+    while ((atual = PopDHeap(&fila, NULL)) >= 0)
+    {
+        // Fixa o vrtice por visitar com maior peso acumulado
+        visitados[atual] = 1;
+
+        // Relaxa as adjacncias do vrtice selecionado
+        CursorCompact cur;
+        int w, peso;
+        BeginAdjCompact(g, atual, &cur);
+        while (NextAdjCompact(&cur, &w, &peso))
+        {
+            if (!visitados[w] && distance[atual] + peso > distance[w])
+            {
+                distance[w] = distance[atual] + peso;
+                anteriores[w] = atual;
+                PushDHeap(&fila, w, -(long long)distance[w]);
+            }
+        }
+    }
+
+    DestroyDHeap(&fila);
+    free(visitados);
+    return true;
+}
+
+#pragma endregion
@@ -0,0 +1,64 @@
+/**
+ * @file   CompactGraph.h
+ * @brief  Definies da representao comprimida (s de leitura) das adjacncias de um grafo.
+ *
+ * As adjacncias de cada vrtice so guardadas por ordem crescente do ndice de destino,
+ * codificadas como diferenas para o destino anterior em inteiros de tamanho varivel
+ * (7 bits por byte). Os pesos ficam num vetor de bytes separado, tambm com tamanho varivel
+ * (com o sinal no bit menos significativo). As consultas descodificam as adjacncias  medida
+ * que as percorrem, com o cursor CursorCompact.
+ *
+ * @date   Outubro 2026
+ * @author Hugo Lopes_30516
+ */
+
+#pragma once
+
+#define _CRT_SECURE_NO_WARNINGS
+
+#ifndef COMPACTGRAPH_H
+#define COMPACTGRAPH_H
+
+#include <stddef.h>
+#include <stdbool.h>
+#include "CSR.h"
+
+ /**
+  * @brief Estrutura para representar um grafo com as adjacncias comprimidas.
+  *
+  * Para o vrtice de ndice k, o nmero de adjacncias e os destinos comeam no byte
+  * posicoes[k] de destinos, e os pesos no byte posicoesPesos[k] de pesos.
+  */
+typedef struct CompactGraph
+{
+    int numVertices;            /* Nmero de vrtices */
+    int numArestas;             /* Nmero de adjacncias */
+    size_t* posicoes;           /* Incio das adjacncias de cada vrtice em destinos (numVertices + 1 posies) */
+    size_t* posicoesPesos;      /* Incio dos pesos de cada vrtice em pesos (numVertices + 1 posies) */
+    unsigned char* destinos;    /* Por vrtice: nmero de adjacncias e diferenas entre destinos consecutivos */
+    unsigned char* pesos;       /* Pesos das adjacncias, pela mesma ordem */
+    int* ids;                   /* ID de cada vrtice (ordenado por ordem crescente) */
+} CompactGraph;
+
+ /**
+  * @brief Cursor para percorrer as adjacncias de um vrtice, descodificando-as.
+  */
+typedef struct
+{
+    const unsigned char* destinos;  /* Prximo byte dos destinos */
+    const unsigned char* pesos;     /* Prximo byte dos pesos */
+    int restantes;                  /* Adjacncias por ler */
+    int destino;                    /* ltimo destino lido */
+} CursorCompact;
+
+CompactGraph* CompressCSR(CSR* c, bool* res);
+CompactGraph* DestroyCompactGraph(CompactGraph* g, bool* res);
+size_t SizeCompactGraph(CompactGraph* g);
+int IndexCompact(CompactGraph* g, int id);
+void BeginAdjCompact(CompactGraph* g, int u, CursorCompact* cur);
+bool NextAdjCompact(CursorCompact* cur, int* destino, int* peso);
+bool DepthFirstSearchCompact(CompactGraph* g, int origem, int dest);
+int CountPathsCompact(CompactGraph* g, int src, int dst);
+bool BestPathCompact(CompactGraph* g, int v, int* anteriores, int* distance);
+
+#endif /* COMPACTGRAPH_H */
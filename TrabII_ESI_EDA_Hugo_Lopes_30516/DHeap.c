@@ -0,0 +1,217 @@
+/**
+ * @file   DHeap.c
+ * @author Hugo Lopes_30516
+ *
+ * @brief Implementao da fila de prioridade (heap d-rio indexado).
+ *
+ * @date   Outubro 2026
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <malloc.h>
+#include <stdbool.h>
+#include "DHeap.h"
+
+
+#pragma region Cria uma fila de prioridade vazia.
+/**
+ * @brief Cria uma fila de prioridade vazia para os elementos 0 .. capacidade-1.
+ *
+ * @param h Apontador para a fila a inicializar.
+ * @param capacidade O nmero de elementos possveis.
+ * @return true se a alocao foi bem-sucedida; false caso contrrio.
+ */
+bool CreateDHeap(DHeap* h, int capacidade)
+{
+    if (h == NULL) return false;
+    memset(h, 0, sizeof(DHeap));
+    return ResizeDHeap(h, capacidade > 16 ? capacidade : 16);
+}
+#pragma endregion
+
+
+#pragma region Aumenta a capacidade de uma fila de prioridade.
+/**
+ * @brief Garante que a fila aceita os elementos 0 .. capacidade-1 (nunca diminui a capacidade).
+ *
+ * @param h A fila.
+ * @param capacidade O nmero de elementos possveis.
+ * @return true se a fila tem a capacidade pedida; false se faltar memria (a fila fica como estava).
+ */
+bool ResizeDHeap(DHeap* h, int capacidade)
+{
+    if (capacidade <= h->capacidade) return true;
+
+    int* elementos = (int*)realloc(h->elementos, capacidade * sizeof(int));
+    if (elementos == NULL) return false;
+    h->elementos = elementos;
+
+    long long* chaves = (long long*)realloc(h->chaves, capacidade * sizeof(long long));
+    if (chaves == NULL) return false;
+    h->chaves = chaves;
+
+    int* posicoes = (int*)realloc(h->posicoes, capacidade * sizeof(int));
+    if (posicoes == NULL) return false;
+    h->posicoes = posicoes;
+
+    // Os novos elementos no esto na fila
+    for (int i = h->capacidade; i < capacidade; i++) h->posicoes[i] = -1;
+    h->capacidade = capacidade;
+    return true;
+}
+#pragma endregion
+
+
+#pragma region Esvazia uma fila de prioridade.
+/**
+ * @brief Retira todos os elementos da fila (custo proporcional ao nmero de elementos na fila).
+ *
+ * @param h A fila.
+ */
+void ClearDHeap(DHeap* h)
+{
+    for (int i = 0; i < h->tamanho; i++) h->posicoes[h->elementos[i]] = -1;
+    h->tamanho = 0;
+}
+#pragma endregion
+
+
+#pragma region Liberta a memria de uma fila de prioridade.
+/**
+ * @brief Liberta a memria de uma fila de prioridade.
+ *
+ * @param h A fila.
+ */
+void DestroyDHeap(DHeap* h)
+{
+    if (h == NULL) return;
+
+    free(h->elementos);
+    free(h->chaves);
+    free(h->posicoes);
+    memset(h, 0, sizeof(DHeap));
+}
+#pragma endregion
+
+
+#pragma region Compara dois elementos da fila.
+/**
+ * @brief Indica se o elemento x sai antes do elemento y (menor chave e, em caso de empate, menor elemento).
+ */
+static bool AntesDHeap(DHeap* h, int x, int y)
+{
+    if (h->chaves[x] != h->chaves[y]) return h->chaves[x] < h->chaves[y];
+    return x < y;
+}
+#pragma endregion
+
+
+#pragma region Sobe um elemento da fila.
+/**
+ * @brief Sobe o elemento da posio i at  sua posio no heap.
+ */
+static void SobeDHeap(DHeap* h, int i)
+{
+    int x = h->elementos[i];
+    while (i > 0)
+    {
+        int pai = (i - 1) / DHEAP_ARIDADE;
+        if (!AntesDHeap(h, x, h->elementos[pai])) break;
+        h->elementos[i] = h->elementos[pai];
+        h->posicoes[h->elementos[i]] = i;
+        i = pai;
+    }
+    h->elementos[i] = x;
+    h->posicoes[x] = i;
+}
+#pragma endregion
+
+
+#pragma region Desce um elemento da fila.
+/**
+ * @brief Desce o elemento da posio i at  sua posio no heap.
+ */
+static void DesceDHeap(DHeap* h, int i)
+{
+    int x = h->elementos[i];
+    for (;;)
+    {
+        // Procura o filho que sai primeiro
+        int primeiro = DHEAP_ARIDADE * i + 1;
+        if (primeiro >= h->tamanho) break;
+        int ultimo = primeiro + DHEAP_ARIDADE;
+        if (ultimo > h->tamanho) ultimo = h->tamanho;
+
+        int melhor = primeiro;
+        for (int f = primeiro + 1; f < ultimo; f++)
+        {
+            if (AntesDHeap(h, h->elementos[f], h->elementos[melhor])) melhor = f;
+        }
+        if (!AntesDHeap(h, h->elementos[melhor], x)) break;
+
+        h->elementos[i] = h->elementos[melhor];
+        h->posicoes[h->elementos[i]] = i;
+        i = melhor;
+    }
+    h->elementos[i] = x;
+    h->posicoes[x] = i;
+}
+#pragma endregion
+
+
+#pragma region Insere um elemento ou diminui a sua chave.
+/**
+ * @brief Insere um elemento na fila ou, se j l estiver, diminui a sua chave.
+ *
+ * @param h A fila.
+ * @param elemento O elemento (0 .. capacidade-1).
+ * @param chave A chave do elemento.
+ * @return true se o elemento foi inserido ou a chave diminuda; false se o elemento for invlido
+ *         ou j estiver na fila com uma chave menor ou igual.
+ */
+bool PushDHeap(DHeap* h, int elemento, long long chave)
+{
+    if ((unsigned)elemento >= (unsigned)h->capacidade) return false;
+
+    int pos = h->posicoes[elemento];
+    if (pos < 0)
+    {
+        h->chaves[elemento] = chave;
+        h->elementos[h->tamanho] = elemento;
+        SobeDHeap(h, h->tamanho++);
+        return true;
+    }
+
+    if (chave >= h->chaves[elemento]) return false;
+    h->chaves[elemento] = chave;
+    SobeDHeap(h, pos);
+    return true;
+}
+#pragma endregion
+
+
+#pragma region Retira o elemento com a menor chave.
+/**
+ * @brief Retira da fila o elemento com a menor chave.
+ *
+ * @param h A fila.
+ * @param chave Apontador que recebe a chave do elemento (pode ser NULL).
+ * @return O elemento retirado, ou -1 se a fila estiver vazia.
+ */
+int PopDHeap(DHeap* h, long long* chave)
+{
+    if (h->tamanho == 0) return -1;
+
+    int x = h->elementos[0];
+    if (chave != NULL) *chave = h->chaves[x];
+    h->posicoes[x] = -1;
+
+    if (--h->tamanho > 0)
+    {
+        h->elementos[0] = h->elementos[h->tamanho];
+        DesceDHeap(h, 0);
+    }
+    return x;
+}
+#pragma endregion
@@ -0,0 +1,45 @@
+/**
+ * @file   DHeap.h
+ * @brief  Definies da fila de prioridade (heap d-rio indexado) usada pelos algoritmos de caminhos.
+ *
+ * Os elementos so inteiros entre 0 e capacidade-1 (posies densas de vrtices), cada um com
+ * uma chave; sai primeiro o elemento com a menor chave e, em caso de empate, o menor elemento.
+ * Como a posio de cada elemento na fila  conhecida, a chave de um elemento que j est
+ * na fila pode ser diminuda sem o inserir outra vez.
+ *
+ * @date   Outubro 2026
+ * @author Hugo Lopes_30516
+ */
+
+#pragma once
+
+#define _CRT_SECURE_NO_WARNINGS
+
+#ifndef DHEAP_H
+#define DHEAP_H
+
+#include <stdbool.h>
+
+/* Nmero de filhos de cada n (4 reduz a altura e mantm os filhos na mesma linha de cache) */
+#define DHEAP_ARIDADE 4
+
+ /**
+  * @brief Estrutura para representar uma fila de prioridade indexada.
+  */
+typedef struct DHeap
+{
+    int* elementos;         /* Elementos da fila, por ordem do heap */
+    long long* chaves;      /* Chave de cada elemento (indexada pelo elemento) */
+    int* posicoes;          /* Posio de cada elemento em elementos, ou -1 se no estiver na fila */
+    int tamanho;            /* Nmero de elementos na fila */
+    int capacidade;         /* Nmero de elementos possveis (0 .. capacidade-1) */
+} DHeap;
+
+bool CreateDHeap(DHeap* h, int capacidade);
+bool ResizeDHeap(DHeap* h, int capacidade);
+void ClearDHeap(DHeap* h);
+void DestroyDHeap(DHeap* h);
+bool PushDHeap(DHeap* h, int elemento, long long chave);
+int PopDHeap(DHeap* h, long long* chave);
+
+#endif /* DHEAP_H */
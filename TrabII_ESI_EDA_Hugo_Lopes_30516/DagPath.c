@@ -0,0 +1,353 @@
+/**
+ * @file   DagPath.c
+ * @author Hugo Lopes_30516
+ *
+ * @brief Implementao do clculo de caminhos mais pesados em grafos acclicos.
+ *
+ * @date   Outubro 2026
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <malloc.h>
+#include <stdbool.h>
+#include "Graph.h"
+#include "CSR.h"
+#include "DagPath.h"
+
+
+#pragma region Cria uma estrutura para os resultados de caminhos mais pesados num DAG.
+/**
+ * @brief Cria uma estrutura para os resultados de HeaviestPathDAG e HeaviestPathDAGCSR.
+ *
+ * @param capacidade Nmero de vrtices esperado (os vetores crescem no clculo, se necessrio).
+ * @param res Apontador para um booleano que indica se a operao foi bem-sucedida.
+ * @return Um apontador para a estrutura criada, ou NULL se faltar memria.
+ */
+DagPath* CreateDagPath(int capacidade, bool* res)
+{
+    *res = false;
+
+    DagPath* dp = (DagPath*)calloc(1, sizeof(DagPath));
+    if (dp == NULL) return NULL;
+    if (capacidade < 16) capacidade = 16;
+
+    dp->ids = (int*)malloc(capacidade * sizeof(int));
+    dp->anteriores = (int*)malloc(capacidade * sizeof(int));
+    dp->distancia = (long long*)malloc(capacidade * sizeof(long long));
+    dp->ordem = (int*)malloc(capacidade * sizeof(int));
+    dp->graus = (int*)malloc(capacidade * sizeof(int));
+    dp->ciclo = (int*)malloc(capacidade * sizeof(int));
+    if (dp->ids == NULL || dp->anteriores == NULL || dp->distancia == NULL || dp->ordem == NULL
+        || dp->graus == NULL || dp->ciclo == NULL)
+    {
+        DestroyDagPath(dp, res);
+        *res = false;
+        return NULL;
+    }
+
+    dp->capacidade = capacidade;
+    dp->origem = dp->fim = -1;
+    *res = true;
+    return dp;
+}
+#pragma endregion
+
+
+#pragma region Liberta a memria de uma estrutura de caminhos mais pesados num DAG.
+/**
+ * @brief Liberta a memria de uma estrutura de resultados de caminhos mais pesados num DAG.
+ *
+ * @param dp A estrutura a libertar.
+ * @param res Apontador para um booleano que indica se a operao foi bem-sucedida.
+ * @return NULL (no h mais estrutura para apontar).
+ */
+DagPath* DestroyDagPath(DagPath* dp, bool* res)
+{
+    if (dp == NULL)
+    {
+        *res = false;
+        return NULL;
+    }
+
+    free(dp->ids);
+    free(dp->anteriores);
+    free(dp->distancia);
+    free(dp->ordem);
+    free(dp->graus);
+    free(dp->ciclo);
+    free(dp);
+
+    *res = true;
+    return NULL;
+}
+#pragma endregion
+
+
+#pragma region Prepara a estrutura para um novo clculo.
+/**
+ * @brief Garante n posies em cada vetor e inicializa distncias, antecessores e graus.
+ *
+ * Com a origem s (posio) s s comea com distncia 0; com s == -1 todos os vrtices podem
+ * comear um caminho, pelo que todos comeam com distncia 0.
+ */
+static bool IniciaDagPath(DagPath* dp, int n, int s)
+{
+    if (n > dp->capacidade)
+    {
+        int novaCap = dp->capacidade * 2;
+        if (novaCap < n) novaCap = n;
+
+        int** vetores[5] = { &dp->ids, &dp->anteriores, &dp->ordem, &dp->graus, &dp->ciclo };
+        for (int i = 0; i < 5; i++)
+        {
+            int* novo = (int*)realloc(*vetores[i], novaCap * sizeof(int));
+            if (novo == NULL) return false;
+            *vetores[i] = novo;
+        }
+        long long* distancia = (long long*)realloc(dp->distancia, novaCap * sizeof(long long));
+        if (distancia == NULL) return false;
+        dp->distancia = distancia;
+        dp->capacidade = novaCap;
+    }
+
+    long long inicial = (s < 0) ? 0 : DISTANCIA_NENHUMA;
+    for (int i = 0; i < n; i++)
+    {
+        dp->distancia[i] = inicial;
+        dp->anteriores[i] = -1;
+        dp->graus[i] = 0;
+    }
+    if (s >= 0) dp->distancia[s] = 0;
+
+    dp->n = n;
+    dp->origem = s;
+    dp->fim = (s >= 0) ? s : -1;
+    dp->tamCiclo = 0;
+    return true;
+}
+#pragma endregion
+
+
+#pragma region Relaxa uma adjacncia.
+/**
+ * @brief Atualiza o caminho mais pesado at w com a adjacncia u -> w e desconta a adjacncia no grau de w.
+ *
+ * @return true se w ficou sem adjacncias de entrada por processar (pode entrar na ordem topolgica).
+ */
+static bool RelaxaDagPath(DagPath* dp, int u, int w, int peso)
+{
+    if (dp->distancia[u] != DISTANCIA_NENHUMA && dp->distancia[u] + peso > dp->distancia[w])
+    {
+        dp->distancia[w] = dp->distancia[u] + peso;
+        dp->anteriores[w] = u;
+    }
+    return --dp->graus[w] == 0;
+}
+#pragma endregion
+
+
+#pragma region Extrai um ciclo dos vrtices que ficaram fora da ordem topolgica.
+/**
+ * @brief Encontra um ciclo a partir dos antecessores dos vrtices que ficaram fora da ordem topolgica.
+ *
+ * Antes de ser chamada, anteriores[w] tem de conter, para cada vrtice w fora da ordem, um
+ * antecessor u tambm fora da ordem (existe sempre, porque w ainda tinha adjacncias de entrada
+ * por processar). Seguindo os antecessores acaba-se por repetir um vrtice, que est num ciclo.
+ */
+static void FechaCicloDagPath(DagPath* dp, int inicio)
+{
+    // Segue os antecessores, marcando os vrtices (grau -1), at repetir um vrtice
+    int x = inicio;
+    while (dp->graus[x] != -1)
+    {
+        dp->graus[x] = -1;
+        x = dp->anteriores[x];
+    }
+
+    // Percorre o ciclo para trs e guarda-o pela ordem das adjacncias
+    int tam = 0;
+    int y = x;
+    do
+    {
+        tam++;
+        y = dp->anteriores[y];
+    } while (y != x);
+
+    dp->tamCiclo = tam;
+    y = x;
+    for (int i = tam - 1; i >= 0; i--)
+    {
+        dp->ciclo[i] = dp->ids[y];
+        y = dp->anteriores[y];
+    }
+}
+#pragma endregion
+
+
+#pragma region ALGORITMOS
+
+/**
+ * @brief Caminhos mais pesados num grafo acclico (ordem topolgica), em O(V + E).
+ *
+ * Ao contrrio de BestPath, o resultado  exato para quaisquer pesos (incluindo negativos),
+ * desde que o grafo no tenha ciclos. Com origem igual a TODAS_ORIGENS, os caminhos podem
+ * comear em qualquer vrtice: dp->fim indica o fim do caminho mais pesado do grafo
+ * (caminho crtico) e dp->distancia[dp->fim] o seu peso.
+ *
+ * @param g O apontador para o grafo.
+ * @param origem O ID do vrtice inicial, ou TODAS_ORIGENS.
+ * @param dp A estrutura onde so guardados os resultados (criada com CreateDagPath e reutilizvel).
+ * @return DAG_OK se o grafo  acclico; DAG_CICLO se tem um ciclo (guardado em dp->ciclo);
+ *         DAG_ERRO se a origem no existir ou faltar memria.
+ */
+int HeaviestPathDAG(Graph* g, int origem, DagPath* dp)
+{
+    if (g == NULL || dp == NULL) return DAG_ERRO;
+
+    int s = -1;
+    if (origem != TODAS_ORIGENS)
+    {
+        Node* inicio = FindHashVertice(&g->indice, origem);
+        if (inicio == NULL) return DAG_ERRO;
+        s = inicio->slot;
+    }
+
+    int n = g->numeroVertices;
+    if (!IniciaDagPath(dp, n, s)) return DAG_ERRO;
+
+    // Conta as adjacncias de entrada de cada vrtice
+    for (int u = 0; u < n; u++)
+    {
+        dp->ids[u] = g->slots[u]->id;
+        for (Adjacent* adj = g->slots[u]->nextAdjacent; adj != NULL; adj = adj->next)
+        {
+            Node* w = FindHashVertice(&g->indice, adj->id);
+            if (w != NULL) dp->graus[w->slot]++;
+        }
+    }
+
+    // Algoritmo de Kahn: ordem serve de fila e fica com a ordem topolgica
+    int fim = 0;
+    for (int u = 0; u < n; u++)
+        if (dp->graus[u] == 0) dp->ordem[fim++] = u;
+
+    for (int i = 0; i < fim; i++)
+    {
+        int u = dp->ordem[i];
+        if (dp->distancia[u] != DISTANCIA_NENHUMA && (dp->fim < 0 || dp->distancia[u] > dp->distancia[dp->fim]))
+            dp->fim = u;
+
+        for (Adjacent* adj = g->slots[u]->nextAdjacent; adj != NULL; adj = adj->next)
+        {
+            Node* w = FindHashVertice(&g->indice, adj->id);
+            if (w != NULL && RelaxaDagPath(dp, u, w->slot, adj->peso)) dp->ordem[fim++] = w->slot;
+        }
+    }
+    if (fim == n) return DAG_OK;
+
+    // H vrtices fora da ordem: guarda, para cada um, um antecessor tambm fora da ordem
+    int resto = -1;
+    for (int u = 0; u < n; u++)
+    {
+        if (dp->graus[u] == 0) continue;
+        resto = u;
+        for (Adjacent* adj = g->slots[u]->nextAdjacent; adj != NULL; adj = adj->next)
+        {
+            Node* w = FindHashVertice(&g->indice, adj->id);
+            if (w != NULL && dp->graus[w->slot] > 0) dp->anteriores[w->slot] = u;
+        }
+    }
+    FechaCicloDagPath(dp, resto);
+    dp->n = 0; // As distncias parciais no so vlidas
+    return DAG_CICLO;
+}
+
+
+/**
+ * @brief Caminhos mais pesados num grafo acclico em formato CSR (ordem topolgica), em O(V + E).
+ *
+ * Equivalente a HeaviestPathDAG, com os resultados indexados pelo ndice dos vrtices na estrutura CSR.
+ *
+ * @param c A estrutura CSR.
+ * @param origem O ID do vrtice inicial, ou TODAS_ORIGENS.
+ * @param dp A estrutura onde so guardados os resultados (criada com CreateDagPath e reutilizvel).
+ * @return DAG_OK se o grafo  acclico; DAG_CICLO se tem um ciclo (guardado em dp->ciclo);
+ *         DAG_ERRO se a origem no existir ou faltar memria.
+ */
+int HeaviestPathDAGCSR(CSR* c, int origem, DagPath* dp)
+{
+    if (c == NULL || dp == NULL) return DAG_ERRO;
+
+    int s = -1;
+    if (origem != TODAS_ORIGENS)
+    {
+        s = IndexCSR(c, origem);
+        if (s < 0) return DAG_ERRO;
+    }
+
+    int n = c->numVertices;
+    if (!IniciaDagPath(dp, n, s)) return DAG_ERRO;
+
+    memcpy(dp->ids, c->ids, n * sizeof(int));
+    for (int e = 0; e < c->numArestas; e++) dp->graus[c->destinos[e]]++;
+
+    int fim = 0;
+    for (int u = 0; u < n; u++)
+        if (dp->graus[u] == 0) dp->ordem[fim++] = u;
+
+    for (int i = 0; i < fim; i++)
+    {
+        int u = dp->ordem[i];
+        if (dp->distancia[u] != DISTANCIA_NENHUMA && (dp->fim < 0 || dp->distancia[u] > dp->distancia[dp->fim]))
+            dp->fim = u;
+
+        for (int e = c->offsets[u]; e < c->offsets[u + 1]; e++)
+        {
+            if (RelaxaDagPath(dp, u, c->destinos[e], c->pesos[e])) dp->ordem[fim++] = c->destinos[e];
+        }
+    }
+    if (fim == n) return DAG_OK;
+
+    int resto = -1;
+    for (int u = 0; u < n; u++)
+    {
+        if (dp->graus[u] == 0) continue;
+        resto = u;
+        for (int e = c->offsets[u]; e < c->offsets[u + 1]; e++)
+        {
+            if (dp->graus[c->destinos[e]] > 0) dp->anteriores[c->destinos[e]] = u;
+        }
+    }
+    FechaCicloDagPath(dp, resto);
+    dp->n = 0; // As distncias parciais no so vlidas
+    return DAG_CICLO;
+}
+
+
+/**
+ * @brief Reconstri o caminho mais pesado at um vrtice, no ltimo clculo.
+ *
+ * O caminho s  escrito se couber em max posies; caso contrrio, o valor devolvido
+ * indica o tamanho necessrio.
+ *
+ * @param dp A estrutura preenchida por HeaviestPathDAG ou HeaviestPathDAGCSR (com DAG_OK).
+ * @param k A posio densa do vrtice final (por exemplo, dp->fim).
+ * @param caminho Vetor que recebe os IDs dos vrtices, do incio do caminho at ao vrtice final.
+ * @param max Nmero de posies de caminho.
+ * @return O nmero de vrtices do caminho, ou 0 se o vrtice no foi alcanado.
+ */
+int PathDagPath(DagPath* dp, int k, int* caminho, int max)
+{
+    if (dp == NULL || k < 0 || k >= dp->n || dp->distancia[k] == DISTANCIA_NENHUMA) return 0;
+
+    int tam = 0;
+    for (int j = k; j >= 0; j = dp->anteriores[j]) tam++;
+    if (tam > max || caminho == NULL) return tam;
+
+    int i = tam;
+    for (int j = k; j >= 0; j = dp->anteriores[j]) caminho[--i] = dp->ids[j];
+    return tam;
+}
+
+#pragma endregion
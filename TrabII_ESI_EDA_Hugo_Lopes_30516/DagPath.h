@@ -0,0 +1,64 @@
+/**
+ * @file   DagPath.h
+ * @brief  Definies do clculo de caminhos mais pesados em grafos acclicos (ordem topolgica).
+ *
+ * Os vrtices so processados por ordem topolgica (algoritmo de Kahn) e cada adjacncia 
+ * relaxada uma nica vez quando o vrtice de origem sai da fila, pelo que o clculo  O(V + E).
+ * Se o grafo tiver um ciclo no existe ordem topolgica: o clculo falha e devolve os vrtices
+ * de um ciclo.
+ *
+ * @date   Outubro 2026
+ * @author Hugo Lopes_30516
+ */
+
+#pragma once
+
+#define _CRT_SECURE_NO_WARNINGS
+
+#ifndef DAGPATH_H
+#define DAGPATH_H
+
+#include <stdbool.h>
+#include <limits.h>
+#include "Graph.h"
+#include "CSR.h"
+
+/* Distncia de um vrtice inalcanvel a partir da origem */
+#define DISTANCIA_NENHUMA LLONG_MIN
+
+/* Valor da origem quando os caminhos podem comear em qualquer vrtice (caminho crtico) */
+#define TODAS_ORIGENS INT_MIN
+
+/* Resultados de HeaviestPathDAG e HeaviestPathDAGCSR */
+#define DAG_ERRO 0      /* Vrtice inexistente ou falta de memria */
+#define DAG_OK 1        /* Grafo acclico: distncias calculadas */
+#define DAG_CICLO -1    /* O grafo tem um ciclo (em ciclo / tamCiclo) */
+
+ /**
+  * @brief Estrutura para guardar os resultados de um clculo de caminhos mais pesados num DAG.
+  *
+  * Os vetores so indexados pela posio densa dos vrtices (Node::slot no grafo, ou o ndice
+  * na estrutura CSR) e podem ser reutilizados em clculos sucessivos.
+  */
+typedef struct DagPath
+{
+    int n;                  /* Nmero de vrtices do ltimo clculo */
+    int capacidade;         /* Nmero de posies reservadas em cada vetor */
+    int origem;             /* Posio do vrtice de origem, ou -1 se foi TODAS_ORIGENS */
+    int fim;                /* Posio do vrtice com a maior distncia (fim do caminho mais pesado) */
+    int* ids;               /* ID do vrtice de cada posio */
+    int* anteriores;        /* Posio do antecessor no caminho mais pesado (-1 no incio do caminho) */
+    long long* distancia;   /* Peso do caminho mais pesado at cada vrtice (DISTANCIA_NENHUMA se inalcanvel) */
+    int* ordem;             /* Posies dos vrtices por ordem topolgica */
+    int* graus;             /* Adjacncias de entrada por processar (uso interno) */
+    int* ciclo;             /* IDs dos vrtices de um ciclo, pela ordem das adjacncias (se DAG_CICLO) */
+    int tamCiclo;           /* Nmero de vrtices em ciclo */
+} DagPath;
+
+DagPath* CreateDagPath(int capacidade, bool* res);
+DagPath* DestroyDagPath(DagPath* dp, bool* res);
+int HeaviestPathDAG(Graph* g, int origem, DagPath* dp);
+int HeaviestPathDAGCSR(CSR* c, int origem, DagPath* dp);
+int PathDagPath(DagPath* dp, int k, int* caminho, int max);
+
+#endif /* DAGPATH_H */
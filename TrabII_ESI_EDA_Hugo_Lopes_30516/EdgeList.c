@@ -0,0 +1,190 @@
+/**
+ * @file   EdgeList.c
+ * @author Hugo Lopes_30516
+ *
+ * @brief Implementao das listas de arestas em vetores.
+ *
+ * @date   Outubro 2026
+ */
+
+#define _CRT_SECURE_NO_WARNINGS
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <malloc.h>
+#include <stdbool.h>
+#include "EdgeList.h"
+
+
+#pragma region Cria uma lista de arestas vazia.
+/**
+ * @brief Cria uma lista de arestas vazia com a capacidade indicada.
+ *
+ * @param b Apontador para a lista a inicializar.
+ * @param capacidade Nmero de arestas esperado (pode ser 0).
+ * @return true se a alocao foi bem-sucedida; false caso contrrio.
+ */
+bool CreateEdgeBuffer(EdgeBuffer* b, int capacidade)
+{
+    if (b == NULL) return false;
+    if (capacidade < 16) capacidade = 16;
+
+    b->origens = (int*)malloc(capacidade * sizeof(int));
+    b->destinos = (int*)malloc(capacidade * sizeof(int));
+    b->pesos = (int*)malloc(capacidade * sizeof(int));
+    b->numArestas = 0;
+    b->capacidade = capacidade;
+
+    if (b->origens == NULL || b->destinos == NULL || b->pesos == NULL)
+    {
+        DestroyEdgeBuffer(b);
+        return false;
+    }
+    return true;
+}
+#pragma endregion
+
+
+#pragma region Acrescenta uma aresta  lista.
+/**
+ * @brief Acrescenta uma aresta ao fim da lista, duplicando a capacidade quando necessrio.
+ *
+ * @param b Apontador para a lista.
+ * @param origem O vrtice de origem.
+ * @param destino O vrtice de destino.
+ * @param peso O peso da aresta.
+ * @return true se a aresta foi acrescentada; false se faltar memria.
+ */
+bool PushEdgeBuffer(EdgeBuffer* b, int origem, int destino, int peso)
+{
+    if (b->numArestas == b->capacidade)
+    {
+        int novaCap = b->capacidade * 2;
+        int* o = (int*)realloc(b->origens, novaCap * sizeof(int));
+        if (o == NULL) return false;
+        b->origens = o;
+        int* d = (int*)realloc(b->destinos, novaCap * sizeof(int));
+        if (d == NULL) return false;
+        b->destinos = d;
+        int* p = (int*)realloc(b->pesos, novaCap * sizeof(int));
+        if (p == NULL) return false;
+        b->pesos = p;
+        b->capacidade = novaCap;
+    }
+
+    b->origens[b->numArestas] = origem;
+    b->destinos[b->numArestas] = destino;
+    b->pesos[b->numArestas] = peso;
+    b->numArestas++;
+    return true;
+}
+#pragma endregion
+
+
+#pragma region Liberta a memria de uma lista de arestas.
+/**
+ * @brief Liberta a memria de uma lista de arestas.
+ *
+ * @param b Apontador para a lista.
+ */
+void DestroyEdgeBuffer(EdgeBuffer* b)
+{
+    if (b == NULL) return;
+
+    free(b->origens);
+    free(b->destinos);
+    free(b->pesos);
+    b->origens = NULL;
+    b->destinos = NULL;
+    b->pesos = NULL;
+    b->numArestas = 0;
+    b->capacidade = 0;
+}
+#pragma endregion
+
+
+#pragma region Compara dois inteiros (para qsort).
+/**
+ * @brief Compara dois inteiros, para ordenar por ordem crescente com qsort.
+ */
+static int ComparaInteiros(const void* a, const void* b)
+{
+    int x = *(const int*)a, y = *(const int*)b;
+    return (x > y) - (x < y);
+}
+#pragma endregion
+
+
+#pragma region Obtm os IDs dos vrtices de uma lista de arestas.
+/**
+ * @brief Obtm os IDs distintos que aparecem como origem ou destino nas arestas, por ordem crescente.
+ *
+ * O vetor devolvido serve para criar os vrtices do grafo por ordem (insero no fim da lista)
+ * e para converter os IDs em ndices densos (pesquisa binria) na construo da estrutura CSR.
+ *
+ * @param b A lista de arestas.
+ * @param numIds Apontador que recebe o nmero de IDs distintos.
+ * @return O vetor de IDs (a libertar com free), ou NULL se faltar memria.
+ */
+int* SortedIdsEdgeBuffer(const EdgeBuffer* b, int* numIds)
+{
+    *numIds = 0;
+
+    size_t n = 2 * (size_t)b->numArestas;
+    int* ids = (int*)malloc((n > 0 ? n : 1) * sizeof(int));
+    if (ids == NULL) return NULL;
+
+    memcpy(ids, b->origens, b->numArestas * sizeof(int));
+    memcpy(ids + b->numArestas, b->destinos, b->numArestas * sizeof(int));
+    qsort(ids, n, sizeof(int), ComparaInteiros);
+
+    // Remove os repetidos
+    size_t k = 0;
+    for (size_t i = 0; i < n; i++)
+    {
+        if (k == 0 || ids[k - 1] != ids[i]) ids[k++] = ids[i];
+    }
+
+    *numIds = (int)k;
+    return ids;
+}
+#pragma endregion
+
+
+#pragma region Guarda uma lista de arestas em formato binrio.
+/**
+ * @brief Guarda uma lista de arestas no formato binrio (EdgeListHeader seguido dos trs vetores).
+ *
+ * Cada vetor  escrito de uma s vez; o ficheiro pode ser lido por readFileEdgesGraph
+ * e readFileEdgesCSR sem converso de texto. As arestas com peso 0 so escritas, mas so
+ * retiradas na leitura, tal como nos ficheiros em texto.
+ *
+ * @param b A lista de arestas.
+ * @param numVertices O nmero de vrtices distintos (0 se desconhecido), guardado no cabealho apenas como informao.
+ * @param ficheiro O nome do ficheiro.
+ * @return true se o ficheiro foi escrito; false caso contrrio.
+ */
+bool SaveEdgeBuffer(const EdgeBuffer* b, int numVertices, const char* ficheiro)
+{
+    if (b == NULL) return false;
+
+    FILE* fp = fopen(ficheiro, "wb");
+    if (fp == NULL) return false;
+
+    EdgeListHeader cab;
+    memcpy(cab.magico, EDGELIST_MAGICO, sizeof(cab.magico));
+    cab.versao = EDGELIST_VERSAO;
+    cab.numVertices = numVertices;
+    cab.numArestas = b->numArestas;
+
+    size_t n = (size_t)b->numArestas;
+    bool ok = fwrite(&cab, sizeof(cab), 1, fp) == 1 &&
+              fwrite(b->origens, sizeof(int), n, fp) == n &&
+              fwrite(b->destinos, sizeof(int), n, fp) == n &&
+              fwrite(b->pesos, sizeof(int), n, fp) == n;
+
+    if (fclose(fp) != 0) ok = false;
+    return ok;
+}
+#pragma endregion
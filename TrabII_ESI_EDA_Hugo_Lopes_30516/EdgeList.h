@@ -0,0 +1,58 @@
+/**
+ * @file   EdgeList.h
+ * @brief  Definies de listas de arestas em vetores (origem, destino, peso).
+ *
+ * Um EdgeBuffer acumula arestas em trs vetores contguos que crescem por duplicao;
+ *  usado como armazenamento intermdio pelos carregadores antes de construir
+ * o grafo ou a estrutura CSR.
+ *
+ * @date   Outubro 2026
+ * @author Hugo Lopes_30516
+ */
+
+#pragma once
+
+#define _CRT_SECURE_NO_WARNINGS
+
+#ifndef EDGELIST_H
+#define EDGELIST_H
+
+#include <stdbool.h>
+
+/* Identificao e verso do formato binrio das listas de arestas */
+#define EDGELIST_MAGICO "EDGL"
+#define EDGELIST_VERSAO 1
+
+ /**
+  * @brief Cabealho do formato binrio das listas de arestas.
+  *
+  *  seguido de trs vetores de numArestas inteiros: as origens, os destinos e os pesos
+  * (os inteiros so guardados na ordem de bytes da mquina que escreveu o ficheiro).
+  */
+typedef struct
+{
+    char magico[4];     /* EDGELIST_MAGICO, sem o '\0' */
+    int versao;         /* EDGELIST_VERSAO */
+    int numVertices;    /* Nmero de vrtices distintos (0 se desconhecido) */
+    int numArestas;     /* Nmero de arestas */
+} EdgeListHeader;
+
+ /**
+  * @brief Estrutura para representar uma lista de arestas em vetores.
+  */
+typedef struct EdgeBuffer
+{
+    int* origens;       /* Vrtice de origem de cada aresta */
+    int* destinos;      /* Vrtice de destino de cada aresta */
+    int* pesos;         /* Peso de cada aresta */
+    int numArestas;     /* Nmero de arestas guardadas */
+    int capacidade;     /* Nmero de arestas que cabem nos vetores */
+} EdgeBuffer;
+
+bool CreateEdgeBuffer(EdgeBuffer* b, int capacidade);
+bool PushEdgeBuffer(EdgeBuffer* b, int origem, int destino, int peso);
+void DestroyEdgeBuffer(EdgeBuffer* b);
+int* SortedIdsEdgeBuffer(const EdgeBuffer* b, int* numIds);
+bool SaveEdgeBuffer(const EdgeBuffer* b, int numVertices, const char* ficheiro);
+
+#endif /* EDGELIST_H */
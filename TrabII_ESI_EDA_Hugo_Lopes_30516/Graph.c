@@ -18,6 +18,160 @@
 #include"Vertices.h"
 #include"Graph.h"
 #include"IN.h"
+#include<string.h>
+
+/* Nmero de registos lidos ou escritos de cada vez por SaveGraph e LoadGraphB */
+#define BLOCO_FICHEIRO 4096
+
+
+#pragma region Inicializa os campos de um grafo.
+/**
+ * Inicializa os campos de um grafo acabado de alocar (ndice e arenas).
+ *
+ * @param G O grafo a inicializar.
+ * @param totV O nmero de vrtices esperado (usado para dimensionar o ndice e as arenas).
+ * @return true se a inicializao foi bem-sucedida; false se a alocao de memria falhar.
+ */
+static bool InitGraph(Graph* G, int totV)
+{
+    G->inicioGraph = NULL;
+    G->fimGraph = NULL;
+    G->numeroVertices = 0;
+    G->numArestas = 0;
+    G->totVertices = totV;
+    G->verticesExternos = 0;
+    G->comEntradas = false;
+
+    // Cria o ndice ID -> vrtice, j dimensionado para o nmero total de vrtices
+    if (!CreateHashVertices(&G->indice, totV)) return false;
+
+    // Vetor das posies densas dos vrtices
+    G->capacidadeSlots = (totV > 16) ? totV : 16;
+    G->slots = (Node**)malloc(G->capacidadeSlots * sizeof(Node*));
+    if (G->slots == NULL)
+    {
+        DestroyHashVertices(&G->indice);
+        return false;
+    }
+
+    // Arenas para os vrtices e para as adjacncias
+    CreateArena(&G->arenaVertices, sizeof(Node), totV);
+    CreateArena(&G->arenaAdjacentes, sizeof(Adjacent), ARENA_BLOCO);
+    return true;
+}
+#pragma endregion
+
+
+#pragma region Arena das adjacncias de um vrtice.
+/**
+ * Devolve a arena de onde so reservadas as adjacncias (de sada e de entrada) de um vrtice.
+ *
+ * S os vrtices criados pelo grafo usam a arena; as listas de um vrtice criado com
+ * CreateVertice (que podem j vir preenchidas com ns criados com malloc) continuam a usar
+ * malloc, para cada lista ter um s dono e ser libertada da mesma forma.
+ *
+ * @param G O grafo.
+ * @param v O vrtice dono da lista.
+ * @return A arena de adjacncias do grafo, ou NULL se as adjacncias do vrtice usarem malloc.
+ */
+static Arena* ArenaAdjacencias(Graph* G, Node* v)
+{
+    return v->emArena ? &G->arenaAdjacentes : NULL;
+}
+#pragma endregion
+
+
+#pragma region Acrescenta uma adjacncia de entrada a um vrtice.
+/**
+ * Acrescenta uma adjacncia de entrada (origem -> destino)  lista de entradas do vrtice de destino.
+ * A ordem das entradas no interessa, pelo que a nova entrada  ligada no incio da lista.
+ *
+ * @param G O grafo (a entrada  reservada como as restantes adjacncias do vrtice de destino).
+ * @param destino O vrtice de destino.
+ * @param origem O ID do vrtice de origem.
+ * @param peso O peso da adjacncia.
+ * @return true se a entrada foi acrescentada; false se faltar memria.
+ */
+static bool InsereEntrada(Graph* G, Node* destino, int origem, int peso)
+{
+    Adjacent* entrada = NewAdjacent(origem, peso, ArenaAdjacencias(G, destino));
+    if (entrada == NULL) return false;
+
+    entrada->next = destino->entradas;
+    destino->entradas = entrada;
+    destino->numEntradas++;
+    return true;
+}
+#pragma endregion
+
+
+#pragma region Remove uma adjacncia de entrada de um vrtice.
+/**
+ * Remove a primeira adjacncia de entrada com a origem e o peso indicados da lista de entradas
+ * do vrtice de destino.
+ *
+ * @param G O grafo (a entrada  libertada como as restantes adjacncias do vrtice de destino).
+ * @param destino O vrtice de destino.
+ * @param origem O ID do vrtice de origem.
+ * @param peso O peso da adjacncia removida.
+ */
+static void RemoveEntrada(Graph* G, Node* destino, int origem, int peso)
+{
+    Adjacent* ant = NULL;
+    for (Adjacent* aux = destino->entradas; aux != NULL; ant = aux, aux = aux->next)
+    {
+        if (aux->id != origem || aux->peso != peso) continue;
+
+        if (ant == NULL) destino->entradas = aux->next;
+        else ant->next = aux->next;
+        DestroyAdjacent(aux, ArenaAdjacencias(G, destino));
+        destino->numEntradas--;
+        return;
+    }
+}
+#pragma endregion
+
+
+#pragma region Regista ou retira as entradas das adjacncias de um vrtice.
+/**
+ * Retira das listas de entrada dos destinos as adjacncias de v, desde a primeira at fim (exclusive).
+ *
+ * @param G O grafo.
+ * @param v O vrtice de origem (pode ainda no estar no ndice do grafo).
+ * @param fim A adjacncia onde parar, ou NULL para as retirar todas.
+ */
+static void RetiraEntradas(Graph* G, Node* v, Adjacent* fim)
+{
+    for (Adjacent* adj = v->nextAdjacent; adj != fim; adj = adj->next)
+    {
+        Node* destino = (adj->id == v->id) ? v : FindHashVertice(&G->indice, adj->id);
+        RemoveEntrada(G, destino, v->id, adj->peso);
+    }
+}
+
+
+/**
+ * Regista as adjacncias de v nas listas de entrada dos vrtices de destino (v inclusive, nos lacetes).
+ * Se faltar memria, retira as entradas j registadas, deixando o grafo como estava.
+ *
+ * @param G O grafo.
+ * @param v O vrtice de origem (pode ainda no estar no ndice do grafo).
+ * @return true se todas as entradas foram registadas; false se faltar memria.
+ */
+static bool RegistaEntradas(Graph* G, Node* v)
+{
+    for (Adjacent* adj = v->nextAdjacent; adj != NULL; adj = adj->next)
+    {
+        Node* destino = (adj->id == v->id) ? v : FindHashVertice(&G->indice, adj->id);
+        if (!InsereEntrada(G, destino, v->id, adj->peso))
+        {
+            RetiraEntradas(G, v, adj);
+            return false;
+        }
+    }
+    return true;
+}
+#pragma endregion
 
 
 #pragma region Cria um novo grafo.
@@ -44,9 +198,11 @@ Graph* CreateGraph(int *totV, bool* res)
     
 
     // Inicializao do grafo
-    aux->inicioGraph = NULL;
-    aux->numeroVertices = 0;
-    aux->totVertices = (*totV);
+    if (!InitGraph(aux, (*totV)))
+    {
+        free(aux);
+        return NULL;
+    }
 
     *res = true; // Indica que a criao do grafo foi bem-sucedida
     return aux; // Retorna o grafo criado
@@ -58,6 +214,10 @@ Graph* CreateGraph(int *totV, bool* res)
 /**
 *Insere um novo vrtice no grafo.
 *
+* Um vrtice criado com CreateVertice pode j trazer adjacncias; tal como em InsertAdjaGraph,
+* todas tm de ir para vrtices que j existem no grafo (ou para o prprio vrtice), seno o
+* vrtice no  inserido. Se alguma operao falhar, o grafo fica como estava.
+*
 * @param G O grafo no qual o vrtice ser inserido.
 * @param id O ID do vrtice a ser inserido.
 * @param res Um apontador para um inteiro que indica o resultado da operao.
@@ -77,22 +237,88 @@ Graph* InsertVertGraph(Graph* G, Node* new, bool* res)
         return NULL;
     }
 
-    // Verifica se o vrtice j existe no grafo
-    if (ExistVertice(G->inicioGraph, new->id))
+    // Verifica se o vrtice  vlido
+    if (new == NULL) return G;
+
+    // Verifica se o vrtice j existe no grafo (consulta ao ndice)
+    if (FindHashVertice(&G->indice, new->id) != NULL)
     {
         *res = false; // Cdigo de erro: Vrtice j existe no grafo
         return G;
     }
 
-    // Insere o vrtice no grafo
-    G->inicioGraph = InsertVertice(G->inicioGraph, new, res);
-    if (G->inicioGraph == NULL)
+    // As adjacncias que j venham na lista tm de apontar para vrtices do grafo
+    for (Adjacent* adj = new->nextAdjacent; adj != NULL; adj = adj->next)
+    {
+        if (adj->id != new->id && FindHashVertice(&G->indice, adj->id) == NULL)
+        {
+            *res = false; // Cdigo de erro: Adjacncia para um vrtice que no existe
+            return G;
+        }
+    }
+
+    // Garante uma posio densa livre para o vrtice
+    if (G->numeroVertices == G->capacidadeSlots)
     {
-        *res = false; // Cdigo de erro: Falha ao inserir vrtice no grafo
+        Node** slots = (Node**)realloc(G->slots, 2 * (size_t)G->capacidadeSlots * sizeof(Node*));
+        if (slots == NULL) return G; // Cdigo de erro: Falha ao alocar memria para as posies
+        G->slots = slots;
+        G->capacidadeSlots *= 2;
+    }
+
+    // Regista as adjacncias que j venham na lista como entradas dos vrtices de destino
+    new->entradas = NULL;
+    new->numEntradas = 0;
+    if (G->comEntradas && !RegistaEntradas(G, new)) return G; // Cdigo de erro: Falha ao alocar memria para as entradas
+
+    // Regista o vrtice no ndice
+    if (!InsertHashVertice(&G->indice, new))
+    {
+        if (G->comEntradas) RetiraEntradas(G, new, NULL);
+        *res = false; // Cdigo de erro: Falha ao alocar memria para o ndice
         return G;
     }
-    else G->numeroVertices++; // Incrementa o nmero de vrtices no grafo
-    
+
+    // Insere o vrtice no grafo
+    if (G->fimGraph == NULL || new->id > G->fimGraph->id)
+    {
+        // O ID  maior que todos os existentes: liga no fim da lista sem a percorrer
+        new->nextVertice = NULL;
+        new->anteriorVertice = G->fimGraph;
+        if (G->fimGraph == NULL) G->inicioGraph = new;
+        else G->fimGraph->nextVertice = new;
+        G->fimGraph = new;
+        *res = true;
+    }
+    else G->inicioGraph = InsertVertice(G->inicioGraph, new, res);
+
+    if (*res == false)
+    {
+        DeleteHashVertice(&G->indice, new->id);
+        if (G->comEntradas) RetiraEntradas(G, new, NULL);
+        return G; // Cdigo de erro: Falha ao inserir vrtice no grafo
+    }
+    else
+    {
+        // Ocupa a posio densa seguinte e incrementa o nmero de vrtices no grafo
+        new->slot = G->numeroVertices;
+        G->slots[G->numeroVertices++] = new;
+    }
+
+    // Conta os vrtices que no pertencem  arena (tm de ser libertados um a um)
+    // e acerta o grau e a ltima adjacncia de uma lista que j venha preenchida
+    if (!new->emArena)
+    {
+        G->verticesExternos++;
+        new->numAdj = 0;
+        new->ultimoAdjacent = NULL;
+        for (Adjacent* adj = new->nextAdjacent; adj != NULL; adj = adj->next)
+        {
+            new->numAdj++;
+            new->ultimoAdjacent = adj;
+        }
+        G->numArestas += new->numAdj;
+    }
 
     // Retorna o grafo atualizado
     return G;
@@ -100,6 +326,49 @@ Graph* InsertVertGraph(Graph* G, Node* new, bool* res)
 #pragma endregion
 
 
+#pragma region Cria e insere um novo vrtice no grafo, reservado da arena do grafo.
+/**
+ * Cria e insere um novo vrtice no grafo. O vrtice  reservado da arena do grafo,
+ * pelo que  libertado em bloco por DestroyGraph.
+ *
+ * @param G O grafo no qual o vrtice ser inserido.
+ * @param id O ID do vrtice a ser criado.
+ * @param res Um apontador para um booleano que indica se a operao foi bem-sucedida.
+ * @return O apontador para o grafo atualizado, ou NULL se o grafo for nulo.
+ */
+Graph* InsertNewVertGraph(Graph* G, int id, bool* res)
+{
+    *res = false;
+    if (G == NULL) return NULL;
+
+    // Verifica se o vrtice j existe no grafo
+    if (FindHashVertice(&G->indice, id) != NULL) return G;
+
+    // Reserva o vrtice da arena
+    Node* novo = (Node*)AllocArena(&G->arenaVertices);
+    if (novo == NULL) return G;
+
+    novo->id = id;
+    novo->slot = -1;
+    novo->visitado = false;
+    novo->emArena = true;
+    novo->numAdj = 0;
+    novo->nextAdjacent = NULL;
+    novo->ultimoAdjacent = NULL;
+    novo->entradas = NULL;
+    novo->numEntradas = 0;
+    novo->nextVertice = NULL;
+    novo->anteriorVertice = NULL;
+
+    // Insere o vrtice no grafo; em caso de erro devolve-o  arena
+    G = InsertVertGraph(G, novo, res);
+    if (!*res) FreeArena(&G->arenaVertices, novo);
+
+    return G;
+}
+#pragma endregion
+
+
 #pragma region Insere uma adjacncia entre dois vrtices no grafo.
 /**
  * Insere uma adjacncia entre dois vrtices no grafo.
@@ -117,13 +386,37 @@ Graph* InsertAdjaGraph(Graph* G, int idOrigin, int idDestiny,int peso, bool* res
     if (G == NULL || G->inicioGraph == NULL) return NULL;
 
     // Encontra os ns correspondentes no grafo
-    Node* originNode = WhereIsVertice(G->inicioGraph, idOrigin);
+    Node* originNode = FindHashVertice(&G->indice, idOrigin);
     if (originNode == NULL) return G;
-    Node* destinyNode = WhereIsVertice(G->inicioGraph, idDestiny);
+    Node* destinyNode = FindHashVertice(&G->indice, idDestiny);
     if (destinyNode == NULL) return G;
 
-    // Insere a adjacncia
-    originNode->nextAdjacent = InsertAdj(originNode->nextAdjacent, idDestiny,peso);
+    // Com as listas de entrada ativas, a entrada  reservada antes, para a adjacncia no ficar meio inserida
+    Adjacent* entrada = NULL;
+    if (G->comEntradas && peso != 0)
+    {
+        entrada = NewAdjacent(idOrigin, peso, ArenaAdjacencias(G, destinyNode));
+        if (entrada == NULL) return G;
+    }
+
+    // Insere a adjacncia no fim da lista do vrtice de origem, em tempo constante
+    bool inserida;
+    InsertAdjVertice(originNode, idDestiny, peso, ArenaAdjacencias(G, originNode), &inserida);
+    if (inserida)
+    {
+        G->numArestas++;
+        if (entrada != NULL)
+        {
+            entrada->next = destinyNode->entradas;
+            destinyNode->entradas = entrada;
+            destinyNode->numEntradas++;
+        }
+    }
+    else if (entrada != NULL)
+    {
+        DestroyAdjacent(entrada, ArenaAdjacencias(G, destinyNode));
+        return G;
+    }
 
     *res = true;
     return G;
@@ -149,13 +442,32 @@ Graph* DeleteAdjGraph(Graph* G, int origin, int destiny, bool* res)
     if (G == NULL || G->inicioGraph == NULL) return NULL;
 
     // Encontra os ns correspondentes no grafo
-    Node* originNode = WhereIsVertice(G->inicioGraph, origin);
+    Node* originNode = FindHashVertice(&G->indice, origin);
     if (originNode == NULL) return G;
-    Node* destinyNode = WhereIsVertice(G->inicioGraph, destiny);
+    Node* destinyNode = FindHashVertice(&G->indice, destiny);
     if (destinyNode == NULL) return G;
 
+    // Peso da adjacncia que vai ser removida (a primeira para o destino), para remover a entrada correspondente
+    int peso = 0;
+    if (G->comEntradas)
+    {
+        for (Adjacent* adj = originNode->nextAdjacent; adj != NULL; adj = adj->next)
+        {
+            if (adj->id == destiny)
+            {
+                peso = adj->peso;
+                break;
+            }
+        }
+    }
+
     // Remove a adjacncia, se existir
-    originNode->nextAdjacent = DeleteAdj(originNode->nextAdjacent, destiny,res);
+    DeleteAdjVertice(originNode, destiny, ArenaAdjacencias(G, originNode), res);
+    if (*res)
+    {
+        G->numArestas--;
+        if (G->comEntradas) RemoveEntrada(G, destinyNode, origin, peso);
+    }
 
     *res = true;
     return G;
@@ -171,14 +483,14 @@ Graph* DeleteAdjGraph(Graph* G, int origin, int destiny, bool* res)
  * @param idVertice O ID do vrtice a ser encontrado.
  * @return Um apontador para o vrtice encontrado, se existir; NULL caso contrrio.
  */
-Graph* WhereIsVertGraph(Graph* G, int idVertice)
+Node* WhereIsVertGraph(Graph* G, int idVertice)
 {
     // Verifica se o grafo  nulo
     if (G == NULL) return NULL;
     
 
-    // Chama a funo WhereIsVertice para procurar o vrtice na lista de vrtices do grafo
-    return (WhereIsVertice(G->inicioGraph, idVertice));
+    // Procura o vrtice no ndice do grafo
+    return (FindHashVertice(&G->indice, idVertice));
 }
 
 #pragma endregion
@@ -188,6 +500,10 @@ Graph* WhereIsVertGraph(Graph* G, int idVertice)
 /**
  * Remove um vrtice e todas as suas adjacncias de um grafo.
  *
+ * O vrtice  encontrado pelo ndice e desligado da lista de vrtices em O(1). Com as listas
+ * de entrada ativas (IncomingEdgesGraph), s so visitadas as listas dos vrtices ligados a ele;
+ * sem elas, so percorridas as listas de adjacncias de todos os vrtices.
+ *
  * @param g O apontador para o grafo onde o vrtice ser removido.
  * @param codVertice O cdigo do vrtice a ser removido.
  * @param res O apontador para uma varivel que armazenar o resultado da operao.
@@ -201,11 +517,67 @@ Graph* DeleteVertGraph(Graph* G, int codVertice, bool* res)
     // Verifica se o grafo  nulo
     if (G == NULL) return NULL;
 
-    // Remove o vrtice da lista de vrtices do grafo
-    G->inicioGraph = DeleteVertice(G->inicioGraph, codVertice, res);
+    // Verifica se o vrtice existe no grafo
+    Node* alvo = FindHashVertice(&G->indice, codVertice);
+    if (alvo == NULL) return G;
+    if (!alvo->emArena) G->verticesExternos--;
 
-    // Remove todas as adjacncias relacionadas ao vrtice removido
-    G->inicioGraph = DeleteAllAdjVert(G->inicioGraph,codVertice, res);
+    // Liberta a posio densa do vrtice, passando para ela o vrtice da ltima posio
+    Node* ultimo = G->slots[G->numeroVertices - 1];
+    G->slots[alvo->slot] = ultimo;
+    ultimo->slot = alvo->slot;
+
+    // Com as listas de entrada, s so visitados os vrtices ligados ao vrtice removido
+    if (G->comEntradas)
+    {
+        // Remove as adjacncias que chegam ao vrtice (os lacetes saem com o prprio vrtice)
+        for (Adjacent* entrada = alvo->entradas; entrada != NULL; entrada = entrada->next)
+        {
+            if (entrada->id == codVertice) continue;
+
+            bool removida;
+            Node* origem = FindHashVertice(&G->indice, entrada->id);
+            DeleteAdjVertice(origem, codVertice, ArenaAdjacencias(G, origem), &removida);
+            if (removida) G->numArestas--;
+        }
+
+        // Retira o vrtice das listas de entrada dos seus destinos
+        for (Adjacent* adj = alvo->nextAdjacent; adj != NULL; adj = adj->next)
+        {
+            if (adj->id == codVertice) continue;
+
+            Node* destino = FindHashVertice(&G->indice, adj->id);
+            if (destino != NULL) RemoveEntrada(G, destino, codVertice, adj->peso);
+        }
+    }
+
+    // Remove o vrtice do ndice e desliga-o da lista de vrtices atravs dos vizinhos na lista,
+    // sem a percorrer (o ltimo vrtice passa a ser o anterior, se foi esse o removido)
+    G->numArestas -= alvo->numAdj;
+    DeleteHashVertice(&G->indice, codVertice);
+    if (alvo->anteriorVertice == NULL) G->inicioGraph = alvo->nextVertice;
+    else alvo->anteriorVertice->nextVertice = alvo->nextVertice;
+    if (alvo->nextVertice == NULL) G->fimGraph = alvo->anteriorVertice;
+    else alvo->nextVertice->anteriorVertice = alvo->anteriorVertice;
+
+    // Liberta as adjacncias (de sada e de entrada) e o vrtice
+    Arena* arenaAdj = ArenaAdjacencias(G, alvo);
+    alvo->nextAdjacent = DeleteAllAdj(alvo->nextAdjacent, arenaAdj, res);
+    alvo->entradas = DeleteAllAdj(alvo->entradas, arenaAdj, res);
+    DestroiVertice(alvo, &G->arenaVertices);
+
+    // Sem as listas de entrada, remove as adjacncias para o vrtice removido em todos os vrtices
+    // (todas, incluindo as repetidas, para no ficarem adjacncias para um vrtice inexistente)
+    for (Node* aux = G->comEntradas ? NULL : G->inicioGraph; aux != NULL; aux = aux->nextVertice)
+    {
+        bool removida;
+        do
+        {
+            DeleteAdjVertice(aux, codVertice, ArenaAdjacencias(G, aux), &removida);
+            if (removida) G->numArestas--;
+        } while (removida);
+    }
+    *res = true;
 
     // Verifica se a remoo foi bem-sucedida
     if (*res == true) G->numeroVertices--;
@@ -218,6 +590,70 @@ Graph* DeleteVertGraph(Graph* G, int codVertice, bool* res)
 #pragma endregion
 
 
+#pragma region Ativa ou desativa as listas de adjacncias de entrada.
+/**
+ * Ativa ou desativa as listas de adjacncias de entrada dos vrtices.
+ *
+ * Quando esto ativas, cada vrtice guarda tambm as adjacncias que chegam a ele
+ * (com o ID do vrtice de origem e o peso), mantidas por InsertAdjaGraph, DeleteAdjGraph
+ * e DeleteVertGraph. A remoo de um vrtice passa a visitar apenas os vrtices ligados a ele,
+ * em vez de todas as listas de adjacncias do grafo, e ficam disponveis as procuras no sentido
+ * inverso. As adjacncias inseridas diretamente com InsertAdjVertice (como fazem os carregadores)
+ * no so registadas, pelo que as listas devem ser ativadas depois de o grafo ser carregado.
+ *
+ * @param G O grafo.
+ * @param ativo true para construir e manter as listas; false para as libertar.
+ * @param res Apontador para um booleano que indica se a operao foi bem-sucedida.
+ * @return O apontador para o grafo.
+ */
+Graph* IncomingEdgesGraph(Graph* G, bool ativo, bool* res)
+{
+    *res = false;
+    if (G == NULL) return NULL;
+
+    if (ativo == G->comEntradas)
+    {
+        *res = true;
+        return G;
+    }
+
+    // Liberta as entradas de todos os vrtices
+    if (!ativo)
+    {
+        bool removidas;
+        for (Node* aux = G->inicioGraph; aux != NULL; aux = aux->nextVertice)
+        {
+            aux->entradas = DeleteAllAdj(aux->entradas, ArenaAdjacencias(G, aux), &removidas);
+            aux->numEntradas = 0;
+        }
+        G->comEntradas = false;
+        *res = true;
+        return G;
+    }
+
+    // Constri as entradas a partir das adjacncias de sada
+    G->comEntradas = true;
+    for (Node* aux = G->inicioGraph; aux != NULL; aux = aux->nextVertice)
+    {
+        for (Adjacent* adj = aux->nextAdjacent; adj != NULL; adj = adj->next)
+        {
+            Node* destino = FindHashVertice(&G->indice, adj->id);
+            if (destino != NULL && !InsereEntrada(G, destino, aux->id, adj->peso))
+            {
+                // Falta de memria: desfaz as entradas j criadas
+                IncomingEdgesGraph(G, false, res);
+                *res = false;
+                return G;
+            }
+        }
+    }
+
+    *res = true;
+    return G;
+}
+#pragma endregion
+
+
 #pragma region Verifica se um vrtice com o ID especificado existe em um grafo.
 /**
  * Verifica se um vrtice com o ID especificado existe em um grafo.
@@ -231,8 +667,8 @@ bool ExistVertGraph(Graph* G, int idVertice)
     // Verifica se o grafo  nulo
     if (G == NULL) return false;
 
-    // Chama a funo ExistVertice para verificar se o vrtice existe na lista de vrtices do grafo
-    return ExistVertice(G->inicioGraph, idVertice);
+    // Consulta o ndice do grafo
+    return (FindHashVertice(&G->indice, idVertice) != NULL);
 }
 #pragma endregion
 
@@ -262,6 +698,10 @@ bool ShowGraph2(Graph* Gr)
 /**
  * Destri um grafo, liberando toda a memria alocada para seus vrtices e adjacncias.
  *
+ * As adjacncias e os vrtices criados pelo grafo esto nas arenas do grafo e so libertados
+ * bloco a bloco; s os vrtices criados com CreateVertice, e as suas listas de adjacncias
+ * (de sada e de entrada), so libertados individualmente.
+ *
  * @param G Apontador para o grafo a ser destrudo.
  * @param res Apontador para uma varivel bool onde ser armazenado o resultado da operao.
  *            Ser definido como verdadeiro se a destruio for bem-sucedida, ou falso caso contrrio.
@@ -275,26 +715,26 @@ Graph* DestroyGraph(Graph* G, bool* res)
         return NULL;
     }
 
-    // Loop para percorrer todos os vrtices
-    Node* currentVert = G->inicioGraph;
+    // Loop para libertar os vrtices que no pertencem  arena (se existirem) e as suas adjacncias
+    Node* currentVert = (G->verticesExternos > 0) ? G->inicioGraph : NULL;
     while (currentVert != NULL) 
     {
         Node* nextVert = currentVert->nextVertice;
-
-        // Loop para percorrer todas as adjacncias de cada vrtice
-        Adjacent* currentAdj = currentVert->nextAdjacent;
-        while (currentAdj != NULL) 
+        if (!currentVert->emArena)
         {
-            Adjacent* nextAdj = currentAdj->next;
-            DestroyAdjacent(currentAdj); // Libera a memria da adjacncia
-            currentAdj = nextAdj;
+            bool removidas;
+            DeleteAllAdj(currentVert->nextAdjacent, NULL, &removidas);
+            DeleteAllAdj(currentVert->entradas, NULL, &removidas);
+            free(currentVert); // Libera a memria do vrtice
         }
-
-        free(currentVert); // Libera a memria do vrtice
         currentVert = nextVert;
     }
 
-    // Libera a memria do grafo
+    // Libera as arenas (vrtices e adjacncias), o ndice e o grafo
+    DestroyArena(&G->arenaVertices);
+    DestroyArena(&G->arenaAdjacentes);
+    DestroyHashVertices(&G->indice);
+    free(G->slots);
     free(G);
 
     // Define o resultado como verdadeiro
@@ -328,10 +768,8 @@ Graph* ins_vert_adj(Graph* G, Node2* inicio, int* vert, int* adj, bool* res)
     {
         for (int i = 0; i < (*adj); i++)
         {
-            // Cria um novo vrtice
-            Node* newVert = CreateVertice(i, res);
-            // Insere o novo vrtice no grafo
-            G = InsertVertGraph(G, newVert, res);
+            // Cria e insere o novo vrtice no grafo
+            G = InsertNewVertGraph(G, i, res);
             // Verifica se a operao de insero foi bem-sucedida
             if (!*res) return G;
         }
@@ -340,10 +778,8 @@ Graph* ins_vert_adj(Graph* G, Node2* inicio, int* vert, int* adj, bool* res)
     {
         for (int i = 0; i < (*vert); i++)
         {
-            // Cria um novo vrtice
-            Node* newVert = CreateVertice(i, res);
-            // Insere o novo vrtice no grafo
-            G = InsertVertGraph(G, newVert, res);
+            // Cria e insere o novo vrtice no grafo
+            G = InsertNewVertGraph(G, i, res);
             // Verifica se a operao de insero foi bem-sucedida
             if (!*res) return G;
         }
@@ -376,13 +812,14 @@ Graph* ins_vert_adj(Graph* G, Node2* inicio, int* vert, int* adj, bool* res)
 /**
  * Salva um grafo num ficheiro binrio.
  *
- * Esta funo salva os dados de um grafo, incluindo seus vrtices e arestas,
- * em um ficheiro binrio.
+ * O ficheiro comea por um GraphFileHeader (identificao, verso e nmeros de vrtices e de
+ * adjacncias), seguido de todos os vrtices (VerticeFile) e depois de todas as adjacncias (AdjFile).
+ * Os registos so juntados em blocos de BLOCO_FICHEIRO e escritos com um fwrite por bloco.
  *
  * @param G O apontador para o grafo a ser salvo.
  * @param fileName O nome do ficheiro onde o grafo ser salvo.
  * @return Retorna 1 se a operao for bem-sucedida, -1 se o grafo fornecido for nulo,
- *         e -2 se houver um erro ao abrir o arquivo.
+ *         -2 se houver um erro ao abrir o arquivo e -3 se houver um erro de escrita ou de memria.
  */
 int SaveGraph(Graph* G, char* fileName)
 {
@@ -392,46 +829,61 @@ int SaveGraph(Graph* G, char* fileName)
     FILE* fp = fopen(fileName, "wb");
     if (fp == NULL) return -2; // Retorna -2 se houver um erro ao abrir o ficheiro
 
-    // Apontador auxiliar para percorrer os vrtices do grafo
-    Node* aux = G->inicioGraph;
-
-    // Variveis auxiliares para armazenar dados dos vrtices e arestas
-    VerticeFile auxFicheiro;
-    AdjFile auxAdj;
-    int numAdj;
-
-    // Loop para percorrer todos os vrtices do grafo
-    while (aux != NULL) {
-        // Preenche a estrutura VerticeFile com os dados do vrtice
-        auxFicheiro.cod = aux->id;
-        numAdj = 0;
-
-        // Conta o nmero de adjacncias
-        Adjacent* adjAux = aux->nextAdjacent;
-        while (adjAux != NULL) {
-            numAdj++;
-            adjAux = adjAux->next;
-        }
-        auxFicheiro.numAdj = numAdj;
-
-        // Escreve o vrtice no ficheiro
-        fwrite(&auxFicheiro, sizeof(VerticeFile), 1, fp);
-
-        // Escreve as adjacncias no ficheiro
-        adjAux = aux->nextAdjacent;
-        while (adjAux != NULL) {
-            auxAdj.codOrigem = aux->id;
-            auxAdj.codDestino = adjAux->id;
-            auxAdj.peso = adjAux->peso;
-            fwrite(&auxAdj, sizeof(AdjFile), 1, fp);
-            adjAux = adjAux->next;
+    // Blocos de registos a escrever de uma s vez
+    VerticeFile* blocoV = (VerticeFile*)malloc(BLOCO_FICHEIRO * sizeof(VerticeFile));
+    AdjFile* blocoA = (AdjFile*)malloc(BLOCO_FICHEIRO * sizeof(AdjFile));
+    bool ok = (blocoV != NULL && blocoA != NULL);
+
+    // Cabealho (as contagens so obtidas da lista, para corresponderem exatamente aos registos)
+    GraphFileHeader cab;
+    memcpy(cab.magico, GRAPHFILE_MAGICO, sizeof(cab.magico));
+    cab.versao = GRAPHFILE_VERSAO;
+    cab.numVertices = 0;
+    cab.numArestas = 0;
+    for (Node* aux = G->inicioGraph; aux != NULL; aux = aux->nextVertice)
+    {
+        cab.numVertices++;
+        cab.numArestas += aux->numAdj;
+    }
+    if (ok) ok = fwrite(&cab, sizeof(cab), 1, fp) == 1;
+
+    // Seco dos vrtices
+    int n = 0;
+    for (Node* aux = G->inicioGraph; ok && aux != NULL; aux = aux->nextVertice)
+    {
+        blocoV[n].cod = aux->id;
+        blocoV[n].numAdj = aux->numAdj;
+        if (++n == BLOCO_FICHEIRO)
+        {
+            ok = fwrite(blocoV, sizeof(VerticeFile), n, fp) == (size_t)n;
+            n = 0;
         }
+    }
+    if (ok && n > 0) ok = fwrite(blocoV, sizeof(VerticeFile), n, fp) == (size_t)n;
 
-        aux = aux->nextVertice; // Avana para o prximo vrtice
+    // Seco das adjacncias, pela mesma ordem dos vrtices
+    n = 0;
+    for (Node* aux = G->inicioGraph; ok && aux != NULL; aux = aux->nextVertice)
+    {
+        for (Adjacent* adjAux = aux->nextAdjacent; ok && adjAux != NULL; adjAux = adjAux->next)
+        {
+            blocoA[n].codOrigem = aux->id;
+            blocoA[n].codDestino = adjAux->id;
+            blocoA[n].peso = adjAux->peso;
+            if (++n == BLOCO_FICHEIRO)
+            {
+                ok = fwrite(blocoA, sizeof(AdjFile), n, fp) == (size_t)n;
+                n = 0;
+            }
+        }
     }
+    if (ok && n > 0) ok = fwrite(blocoA, sizeof(AdjFile), n, fp) == (size_t)n;
+
+    free(blocoV);
+    free(blocoA);
+    if (fclose(fp) != 0) ok = false; // Fecha o ficheiro aps a escrita
 
-    fclose(fp); // Fecha o ficheiro aps a escrita
-    return 1; // Retorna 1 indicando que a operao foi bem-sucedida
+    return ok ? 1 : -3; // Retorna 1 indicando que a operao foi bem-sucedida
 }
 
 #pragma endregion
@@ -439,86 +891,107 @@ int SaveGraph(Graph* G, char* fileName)
 
 #pragma region Carrega um grafo de um ficheiro binrio.
 /**
- * Carrega um grafo de um ficheiro binrio.
+ * Carrega um grafo de um ficheiro binrio escrito por SaveGraph.
  *
- * Esta funo carrega os dados de um grafo a partir de um ficheiro binrio.
+ * Os vrtices so lidos com um nico fread e, como esto por ordem crescente de ID, cada insero
+ *  feita no fim da lista; as adjacncias so lidas em blocos de BLOCO_FICHEIRO e acrescentadas
+ * ao fim da lista do vrtice de origem.
  *
  * @param ficheiro O nome do ficheiro a ser lido.
  * @param resultado Apontador para uma varivel bool onde ser armazenado o resultado da operao.
  *                  Ser definido como verdadeiro se a operao for bem-sucedida, ou falso caso contrrio.
- * @return Retorna um apontador para o grafo carregado, ou NULL se a operao falhar.
+ * @return Retorna um apontador para o grafo carregado, ou NULL se a operao falhar
+ *         (ficheiro inexistente, de outro formato ou verso, truncado, ou com adjacncias
+ *         para vrtices que no esto no ficheiro ou em nmero diferente do indicado em cada vrtice).
  */
 Graph* LoadGraphB(const char* ficheiro, bool* resultado)
 {
+    *resultado = false;
+
     // Abre o ficheiro binrio para leitura
     FILE* fp = fopen(ficheiro, "rb");
-    if (fp == NULL) {
-        *resultado = false;
-        return NULL;
-    }
+    if (fp == NULL) return NULL;
 
-    // Aloca memria para o grafo
-    Graph* grafo = (Graph*)malloc(sizeof(Graph));
-    if (grafo == NULL) {
+    // L e valida o cabealho
+    GraphFileHeader cab;
+    if (fread(&cab, sizeof(cab), 1, fp) != 1 || memcmp(cab.magico, GRAPHFILE_MAGICO, sizeof(cab.magico)) != 0 ||
+        cab.versao != GRAPHFILE_VERSAO || cab.numVertices < 0 || cab.numArestas < 0)
+    {
         fclose(fp);
-        *resultado = false;
         return NULL;
     }
 
-    // Inicializa o grafo
-    grafo->inicioGraph = NULL;
-    grafo->numeroVertices = 0;
+    // L todos os vrtices de uma s vez
+    VerticeFile* vertices = (VerticeFile*)malloc((cab.numVertices > 0 ? cab.numVertices : 1) * sizeof(VerticeFile));
+    AdjFile* blocoA = (AdjFile*)malloc(BLOCO_FICHEIRO * sizeof(AdjFile));
+    Graph* grafo = (Graph*)malloc(sizeof(Graph));
+    bool ok = (vertices != NULL && blocoA != NULL && grafo != NULL) &&
+              fread(vertices, sizeof(VerticeFile), cab.numVertices, fp) == (size_t)cab.numVertices;
+
+    // Inicializa o grafo (ndice e arenas dimensionados para o nmero de vrtices)
+    if (ok) ok = InitGraph(grafo, cab.numVertices > 0 ? cab.numVertices : 1);
+    if (!ok)
+    {
+        free(grafo);
+        grafo = NULL;
+    }
 
-    // L o nmero de vrtices do ficheiro
-    int numVertices;
-    fread(&numVertices, sizeof(int), 1, fp);
+    // Cria os vrtices e confirma que o nmero de adjacncias coincide com o cabealho
+    long long somaAdj = 0;
+    for (int i = 0; ok && i < cab.numVertices; i++)
+    {
+        grafo = InsertNewVertGraph(grafo, vertices[i].cod, resultado);
+        ok = *resultado;
+        somaAdj += vertices[i].numAdj;
+    }
+    if (somaAdj != cab.numArestas) ok = false;
 
-    // Loop para ler os vrtices do ficheiro
-    for (int i = 0; i < numVertices; i++) 
+    // L as adjacncias em blocos e acrescenta-as ao vrtice de origem
+    Node* origem = NULL;
+    for (int lidas = 0; ok && lidas < cab.numArestas;)
     {
-        // Aloca memria para o vrtice
-        Node* vertice = (Node*)malloc(sizeof(Node));
-        if (vertice == NULL) 
+        int n = cab.numArestas - lidas;
+        if (n > BLOCO_FICHEIRO) n = BLOCO_FICHEIRO;
+        if (fread(blocoA, sizeof(AdjFile), n, fp) != (size_t)n)
         {
-            fclose(fp);
-            DestroyGraph(grafo, resultado); // Liberta a memria alocada para o grafo
-            *resultado = false;
-            return NULL;
+            ok = false;
+            break;
         }
 
-        // L o ID do vrtice do ficheiro
-        fread(&vertice->id, sizeof(int), 1, fp);
-
-        // L o nmero de adjacncias do vrtice
-        int numAdjacentes;
-        fread(&numAdjacentes, sizeof(int), 1, fp);
-
-        // Inicializa as listas de adjacncias do vrtice
-        vertice->nextAdjacent = NULL;
-        vertice->nextVertice = NULL;
-
-        // Loop para ler as adjacncias do vrtice
-        for (int j = 0; j < numAdjacentes; j++) {
-            int idAdjacente;
-            // L o ID do vrtice adjacente e o peso da aresta
-            fread(&idAdjacente, sizeof(int), 1, fp);
-            int peso;
-            fread(&peso, sizeof(int), 1, fp);
+        for (int e = 0; ok && e < n; e++)
+        {
+            // O destino tem de ser um dos vrtices do ficheiro
+            if (FindHashVertice(&grafo->indice, blocoA[e].codDestino) == NULL)
+            {
+                ok = false;
+                break;
+            }
 
-            // Insere a adjacncia na lista de adjacncias do vrtice
-            vertice->nextAdjacent = InsertAdj(vertice->nextAdjacent, idAdjacente, peso);
+            if (origem == NULL || origem->id != blocoA[e].codOrigem) origem = FindHashVertice(&grafo->indice, blocoA[e].codOrigem);
+            InsertAdjVertice(origem, blocoA[e].codDestino, blocoA[e].peso, &grafo->arenaAdjacentes, resultado);
+            ok = *resultado;
+            if (ok) grafo->numArestas++;
         }
+        lidas += n;
+    }
 
-        // Insere o vrtice no grafo
-        grafo = InsertVertGraph(grafo, vertice, resultado);
-        if (*resultado == false) {
-            fclose(fp);
-            DestroyGraph(grafo, resultado); // Liberta a memria alocada para o grafo
-            return NULL;
-        }
+    // Cada vrtice tem de ter exatamente as adjacncias indicadas no seu registo
+    for (int i = 0; ok && i < cab.numVertices; i++)
+    {
+        if (FindHashVertice(&grafo->indice, vertices[i].cod)->numAdj != vertices[i].numAdj) ok = false;
     }
 
+    free(vertices);
+    free(blocoA);
     fclose(fp);
+
+    if (!ok)
+    {
+        if (grafo != NULL) DestroyGraph(grafo, resultado);
+        *resultado = false;
+        return NULL;
+    }
+
     *resultado = true;
     return grafo;
 }
@@ -536,13 +1009,8 @@ Graph* LoadGraphB(const char* ficheiro, bool* resultado)
  */
 Node* FindVerticeId(Graph* g, int cod)
 {
-    Node* aux = g->inicioGraph; // Inicializa o apontador auxiliar para o incio do grafo
-    while (aux != NULL) { // Percorre a lista de vrtices do grafo
-        if (aux->id == cod) // Verifica se o ID do vrtice atual  igual ao ID procurado
-            return aux; // Retorna o apontador para o vrtice encontrado
-        aux = aux->nextVertice; // Avana para o prximo vrtice na lista
-    }
-    return NULL; // Retorna NULL se o vrtice no for encontrado
+    if (g == NULL) return NULL; // Retorna NULL se o grafo fornecido for nulo
+    return FindHashVertice(&g->indice, cod); // Consulta o ndice ID -> vrtice em tempo constante
 }
 
 #pragma endregion   
@@ -576,13 +1044,16 @@ Graph* ResetVerticesVisitados(Graph* g) {
  * @brief Conta o nmero de caminhos possveis entre dois vrtices num grafo.
  *
  * Esta funo calcula o nmero de caminhos possveis entre dois vrtices
- * num grafo no direcionado.
+ * num grafo no direcionado. Em vez de uma chamada recursiva por vrtice do caminho,
+ * guarda o caminho atual numa pilha explcita (com a prxima adjacncia a seguir
+ * em cada vrtice), pelo que caminhos longos no esgotam a pilha de execuo.
  *
  * @param g O apontador para o grafo onde ser feita a contagem de caminhos.
  * @param src O ID do vrtice de origem.
  * @param dst O ID do vrtice de destino.
  * @param pathCount O nmero atual de caminhos contados.
- * @return O nmero total de caminhos possveis entre os vrtices de origem e destino.
+ * @return O nmero total de caminhos possveis entre os vrtices de origem e destino
+ *         (pathCount, sem alteraes, se faltar memria).
  * @author lufer
  */
 int CountPaths(Graph* g, int src, int dst, int pathCount)
@@ -594,18 +1065,43 @@ int CountPaths(Graph* g, int src, int dst, int pathCount)
     Node* aux = FindVerticeId(g, src); // Encontra o vrtice de origem no grafo
     if (aux == NULL) return pathCount; // Retorna o nmero de caminhos se a origem no for encontrada no grafo
 
+    // Cada vrtice do caminho atual est marcado, pelo que o caminho tem no mximo numeroVertices vrtices
+    Node** pilha = (Node**)malloc(g->numeroVertices * sizeof(Node*));
+    Adjacent** cursores = (Adjacent**)malloc(g->numeroVertices * sizeof(Adjacent*));
+    if (pilha == NULL || cursores == NULL)
+    {
+        free(pilha);
+        free(cursores);
+        return pathCount;
+    }
+
     aux->visitado = true; // Marca o vrtice de origem como visitado
+    pilha[0] = aux;
+    cursores[0] = aux->nextAdjacent;
+    int topo = 1;
+
+    while (topo > 0) {
+        Adjacent* hAdj = cursores[topo - 1];
+        if (hAdj == NULL) { // Todas as adjacncias do vrtice do topo foram seguidas
+            pilha[--topo]->visitado = false; // Desmarca o vrtice para permitir outros caminhos
+            continue;
+        }
+        cursores[topo - 1] = hAdj->next; // Avana para a prxima adjacncia do vrtice do topo
 
-    Adjacent* hAdj = aux->nextAdjacent; // Apontador para a lista de adjacncias do vrtice de origem
-    while (hAdj) { // Percorre todas as adjacncias do vrtice de origem
         Node* v = FindVerticeId(g, hAdj->id); // Encontra o vrtice adjacente no grafo
-        if (v && !v->visitado) { // Verifica se o vrtice adjacente existe e no foi visitado
-            pathCount = CountPaths(g, hAdj->id, dst, pathCount); // Chamada recursiva para contar caminhos a partir do vrtice adjacente
+        if (v == NULL || v->visitado) continue;
+        if (v->id == dst) { // Chegou ao destino: mais um caminho
+            pathCount++;
+            continue;
         }
-        hAdj = hAdj->next; // Avana para a prxima adjacncia do vrtice de origem
+
+        v->visitado = true; // Acrescenta o vrtice adjacente ao caminho atual
+        pilha[topo] = v;
+        cursores[topo++] = v->nextAdjacent;
     }
 
-    aux->visitado = false; // Desmarca o vrtice de origem para permitir outros caminhos
+    free(pilha);
+    free(cursores);
     return pathCount; // Retorna o nmero total de caminhos possveis entre os vrtices de origem e destino
 }
 
@@ -615,7 +1111,7 @@ int CountPaths(Graph* g, int src, int dst, int pathCount)
  *
  * Esta funo conta o nmero de caminhos possveis entre dois vrtices num grafo
  * no direcionado, utilizando uma funo auxiliar para reiniciar o estado "visitado"
- * de todos os vrtices antes de iniciar a contagem de caminhos.  uma funo recursiva.
+ * de todos os vrtices antes de iniciar a contagem de caminhos.
  *
  * @param g O apontador para o grafo onde ser feita a contagem de caminhos.
  * @param src O ID do vrtice de origem.
@@ -631,10 +1127,47 @@ int CountPathsVertices(Graph* g, int src, int dest)
 
 
 /**
- * @brief Busca em Profundidade Recursiva.
+ * @brief Procura em profundidade a partir de um vrtice, seguindo as adjacncias de sada ou de entrada.
+ *
+ * Usa uma pilha explcita com os vrtices marcados e ainda por expandir: cada vrtice entra
+ * na pilha uma nica vez, pelo que a pilha tem no mximo numeroVertices posies.
+ */
+static bool DepthFirstSearchIter(Graph* g, Node* inicio, int alvo, bool entradas)
+{
+    Node** pilha = (Node**)malloc(g->numeroVertices * sizeof(Node*));
+    if (pilha == NULL) return false;
+
+    inicio->visitado = true;
+    pilha[0] = inicio;
+    int topo = 1;
+    bool existe = false;
+
+    while (topo > 0 && !existe) {
+        Node* u = pilha[--topo];
+        for (Adjacent* hAdj = entradas ? u->entradas : u->nextAdjacent; hAdj != NULL; hAdj = hAdj->next) {
+            Node* v = FindVerticeId(g, hAdj->id); // Encontra o vrtice adjacente no grafo
+            if (v == NULL || v->visitado) continue;
+            if (v->id == alvo) { // Retorna true se um caminho for encontrado
+                existe = true;
+                break;
+            }
+            v->visitado = true; // Marca o vrtice e guarda-o para expandir mais tarde
+            pilha[topo++] = v;
+        }
+    }
+
+    free(pilha);
+    return existe;
+}
+
+
+/**
+ * @brief Busca em Profundidade.
  *
  * Esta funo verifica se existe um caminho entre dois vrtices num grafo,
- * utilizando o algoritmo de busca em profundidade (Depth-First Search - DFS) de forma recursiva.
+ * utilizando o algoritmo de busca em profundidade (Depth-First Search - DFS).
+ * A procura  iterativa, com uma pilha explcita (o nome mantm-se por compatibilidade),
+ * pelo que no depende da profundidade do grafo.
  *
  * @param g O apontador para o grafo onde ser realizada a busca.
  * @param origem O ID do vrtice de origem.
@@ -648,96 +1181,188 @@ bool DepthFirstSearchRec(Graph* g, int origem, int dest) {
     Node* aux = FindVerticeId(g, origem); // Encontra o vrtice de origem no grafo
     if (aux == NULL) return false; // Retorna false se a origem no for encontrada no grafo
 
-    aux->visitado = true; // Marca o vrtice de origem como visitado
+    return DepthFirstSearchIter(g, aux, dest, false);
+}
 
-    Adjacent* hAdj = aux->nextAdjacent; // Apontador para a lista de adjacncias do vrtice de origem
-    while (hAdj) { // Percorre todas as adjacncias do vrtice de origem
-        Node* v = FindVerticeId(g, hAdj->id); // Encontra o vrtice adjacente no grafo
-        if (v && !v->visitado) { // Verifica se o vrtice adjacente existe e no foi visitado
-            if (DepthFirstSearchRec(g, hAdj->id, dest)) { // Chamada recursiva para verificar se h um caminho entre o vrtice adjacente e o destino
-                return true; // Retorna true se um caminho for encontrado
-            }
-        }
-        hAdj = hAdj->next; // Avana para a prxima adjacncia do vrtice de origem
+
+/**
+ * @brief Busca em Profundidade no sentido inverso das adjacncias.
+ *
+ * Verifica se existe um caminho de origem at dest partindo do destino e seguindo
+ * as listas de adjacncias de entrada (ver IncomingEdgesGraph).  til quando o destino
+ *  alcanado por poucos vrtices, pois s estes so visitados. Tal como DepthFirstSearchRec,
+ * usa o estado "visitado" dos vrtices, que deve ser limpo com ResetVerticesVisitados.
+ *
+ * @param g O apontador para o grafo onde ser realizada a busca.
+ * @param dest O ID do vrtice de destino (onde a busca comea).
+ * @param origem O ID do vrtice de origem.
+ * @return Retorna true se existir um caminho entre os vrtices de origem e destino, false caso contrrio
+ *         (ou se as listas de entrada no estiverem ativas).
+ */
+bool ReverseDepthFirstSearchRec(Graph* g, int dest, int origem) {
+    if (origem == dest) return true; // Retorna true se a origem for igual ao destino
+    if (g == NULL || !g->comEntradas) return false;
+
+    Node* aux = FindVerticeId(g, dest); // Encontra o vrtice de destino no grafo
+    if (aux == NULL) return false;
+
+    return DepthFirstSearchIter(g, aux, origem, true);
+}
+
+
+/**
+ * @brief Cria uma estrutura para os resultados de BestPath.
+ *
+ * @param capacidade Nmero de vrtices esperado (os vetores crescem em BestPath, se necessrio).
+ * @param res Apontador para um booleano que indica se a operao foi bem-sucedida.
+ * @return Um apontador para a estrutura criada, ou NULL se faltar memria.
+ */
+Best* CreateBest(int capacidade, bool* res)
+{
+    *res = false;
+
+    Best* b = (Best*)calloc(1, sizeof(Best));
+    if (b == NULL) return NULL;
+    if (capacidade < 16) capacidade = 16;
+
+    b->ids = (int*)malloc(capacidade * sizeof(int));
+    b->anteriores = (int*)malloc(capacidade * sizeof(int));
+    b->distance = (int*)malloc(capacidade * sizeof(int));
+    b->visitados = (bool*)malloc(capacidade * sizeof(bool));
+    if (b->ids == NULL || b->anteriores == NULL || b->distance == NULL || b->visitados == NULL
+        || !CreateDHeap(&b->fila, capacidade))
+    {
+        DestroyBest(b, res);
+        *res = false;
+        return NULL;
+    }
+
+    b->capacidade = capacidade;
+    *res = true;
+    return b;
+}
+
+
+/**
+ * @brief Liberta a memria de uma estrutura de resultados de BestPath.
+ *
+ * @param b A estrutura a libertar.
+ * @param res Apontador para um booleano que indica se a operao foi bem-sucedida.
+ * @return NULL (no h mais estrutura para apontar).
+ */
+Best* DestroyBest(Best* b, bool* res)
+{
+    if (b == NULL)
+    {
+        *res = false;
+        return NULL;
     }
 
-    return false; // Retorna false se nenhum caminho for encontrado
+    free(b->ids);
+    free(b->anteriores);
+    free(b->distance);
+    free(b->visitados);
+    DestroyDHeap(&b->fila);
+    free(b);
+
+    *res = true;
+    return NULL;
 }
 
 
 /**
- * @brief Algoritmo de Dijkstra.
+ * @brief Garante que os vetores da estrutura tm pelo menos n posies.
+ */
+static bool GaranteCapacidadeBest(Best* b, int n)
+{
+    if (n <= b->capacidade) return true;
+
+    int novaCap = b->capacidade * 2;
+    if (novaCap < n) novaCap = n;
+
+    int** vetores[3] = { &b->ids, &b->anteriores, &b->distance };
+    for (int i = 0; i < 3; i++)
+    {
+        int* novo = (int*)realloc(*vetores[i], novaCap * sizeof(int));
+        if (novo == NULL) return false;
+        *vetores[i] = novo;
+    }
+    bool* visitados = (bool*)realloc(b->visitados, novaCap * sizeof(bool));
+    if (visitados == NULL) return false;
+    b->visitados = visitados;
+    if (!ResizeDHeap(&b->fila, novaCap)) return false;
+    b->capacidade = novaCap;
+    return true;
+}
+
+
+/**
+ * @brief Caminho mais pesado a partir de um vrtice.
  *
- * Este algoritmo calcula o caminho mais longo de um vrtice inicial para todos os outros vrtices em um grafo ponderado no direcionado.
+ * Segue a mesma seleo gulosa do algoritmo original (em cada passo fixa o vrtice por visitar
+ * com maior peso acumulado e relaxa as suas adjacncias), mas percorre diretamente as listas
+ * de adjacncias: no h matriz de custos nem limite de vrtices. O vrtice seguinte  obtido
+ * de uma fila de prioridade (DHeap) em vez de uma pesquisa por todos os vrtices, pelo que o custo 
+ * O((V + E) log V). Os resultados ficam em b, indexados pela posio densa dos vrtices
+ * (b->ids[k]  o ID do vrtice k); os vrtices inalcanveis ficam com distncia MAXDISTANCE
+ * e antecessor igual ao vrtice inicial.
  *
  * @param g O apontador para o grafo.
- * @param n O nmero total de vrtices no grafo.
- * @param v O vrtice inicial para o qual ser calculado o caminho mais longo.
- * @return Retorna uma estrutura `Best` contendo o caminho mais longo e os vrtices predecessores para cada vrtice no grafo.
+ * @param v O ID do vrtice inicial.
+ * @param b A estrutura onde so guardados os resultados (criada com CreateBest e reutilizvel).
+ * @return true se o clculo foi feito; false se o vrtice no existir ou faltar memria.
  * @author lufer
  */
-Best BestPath(Graph* g, int n, int v) {
-    int cost[MAX][MAX], distance[MAX], pred[MAX];
-    int visited[MAX], count, mindistance, nextnode;
+bool BestPath(Graph* g, int v, Best* b)
+{
+    if (g == NULL || b == NULL) return false;
 
-    // Inicializa a matriz de custos com MAXDISTANCE
-    for (int i = 0; i < n; i++)
-        for (int j = 0; j < n; j++)
-            cost[i][j] = MAXDISTANCE;
-
-    // Preenche a matriz de custos com os pesos das adjacncias
-    Node* aux = g->inicioGraph;
-    while (aux) {
-        Adjacent* auxAdj = aux->nextAdjacent;
-        while (auxAdj) {
-            cost[aux->id][auxAdj->id] = auxAdj->peso;
-            auxAdj = auxAdj->next;
-        }
-        aux = aux->nextVertice;
-    }
+    Node* inicio = FindHashVertice(&g->indice, v);
+    if (inicio == NULL) return false;
+
+    int n = g->numeroVertices;
+    if (!GaranteCapacidadeBest(b, n)) return false;
 
-    // Inicializa distance, pred e visited
-    for (int i = 0; i < n; i++) {
-        distance[i] = cost[v][i];
-        pred[i] = v;
-        visited[i] = 0;
+    // Inicializa distance, anteriores e a fila
+    int s = inicio->slot;
+    for (int i = 0; i < n; i++)
+    {
+        b->ids[i] = g->slots[i]->id;
+        b->distance[i] = MAXDISTANCE;
+        b->anteriores[i] = s;
+        b->visitados[i] = false;
     }
+    b->n = n;
+    b->origem = s;
+    b->distance[s] = 0;
 
-    distance[v] = 0;
-    visited[v] = 1;
-    count = 1;
+    // A fila retira primeiro a menor chave: a chave  o peso acumulado com o sinal trocado
+    ClearDHeap(&b->fila);
+    PushDHeap(&b->fila, s, 0);
 
-    while (count < n - 1) {
-        mindistance = MAXDISTANCE;
+    int atual;
+    while ((atual = PopDHeap(&b->fila, NULL)) >= 0)
+    {
+        // Fixa o vrtice por visitar com maior peso acumulado
+        b->visitados[atual] = true;
 
-        
-        for (int i = 0; i < n; i++) {
-            if (distance[i] > mindistance && !visited[i]) {
-                mindistance = distance[i];
-                nextnode = i;
-            }
-        }
+        // Relaxa as adjacncias do vrtice selecionado
+        for (Adjacent* adj = g->slots[atual]->nextAdjacent; adj != NULL; adj = adj->next)
+        {
+            Node* w = FindHashVertice(&g->indice, adj->id);
+            if (w == NULL || b->visitados[w->slot]) continue;
 
-      
-        visited[nextnode] = 1;
-        for (int i = 0; i < n; i++) {
-            if (!visited[i]) {
-                if (mindistance + cost[nextnode][i] > distance[i]) {
-                    distance[i] = mindistance + cost[nextnode][i];
-                    pred[i] = nextnode;
-                }
+            int k = w->slot;
+            if (b->distance[atual] + adj->peso > b->distance[k])
+            {
+                b->distance[k] = b->distance[atual] + adj->peso;
+                b->anteriores[k] = atual;
+                PushDHeap(&b->fila, k, -(long long)b->distance[k]);
             }
         }
-        count++;
     }
 
-    // Prepara o resultado
-    Best b;
-    for (int i = 0; i < n; i++) {
-        b.anteriores[i] = pred[i];
-        b.distance[i] = distance[i];
-    }
-    return b;
+    return true;
 }
 
 /**
@@ -747,28 +1372,29 @@ Best BestPath(Graph* g, int n, int v) {
  * usando as informaes fornecidas pela estrutura `Best`, que contm os caminhos mais longos
  * e os vrtices predecessores para cada vrtice no grafo.
  *
- * @param b A estrutura `Best` contendo os caminhos mais longos e os vrtices predecessores.
- * @param n O nmero total de vrtices no grafo.
- * @param v O vrtice inicial a partir do qual os caminhos sero mostrados.
+ * @param b A estrutura `Best` preenchida por BestPath.
  * @return Void (sem retorno).
  */
-void ShowAllPath(Best b, int n, int v) 
+void ShowAllPath(Best* b) 
 { 
-    printf("Peso mximo a partir do vertice %d\n", v);
+    if (b == NULL || b->n == 0) return;
+
+    int v = b->origem;
+    printf("Peso mximo a partir do vertice %d\n", b->ids[v]);
     int j;
-    for (int i = 0; i < n; i++) 
+    for (int i = 0; i < b->n; i++) 
     {
         if (i != v) 
         {
            
-            printf("\n\nPeso at ao vertice %d = %d", i, b.distance[i]);
-            printf("\nCaminho = %d", i);
+            printf("\n\nPeso at ao vertice %d = %d", b->ids[i], b->distance[i]);
+            printf("\nCaminho = %d", b->ids[i]);
 
             j = i;
             do 
             {
-                j = b.anteriores[j];
-                printf(" <- %d", j);
+                j = b->anteriores[j];
+                printf(" <- %d", b->ids[j]);
             } while (j != v);
         }
     }
@@ -19,8 +19,29 @@
 #include <stdbool.h>
 #include "VerticesAdjacent.h"
 #include "Vertices.h"
+#include "HashVertices.h"
+#include "Arena.h"
+#include "DHeap.h"
 #include "IN.h"
 
+/* Identificao e verso do formato binrio de SaveGraph / LoadGraphB */
+#define GRAPHFILE_MAGICO "GRFB"
+#define GRAPHFILE_VERSAO 1
+
+ /**
+  * @brief Cabealho do ficheiro binrio de um grafo.
+  *
+  *  seguido de numVertices registos VerticeFile (por ordem crescente de ID) e de
+  * numArestas registos AdjFile, agrupados por vrtice de origem pela mesma ordem.
+  */
+typedef struct
+{
+    char magico[4];     /* GRAPHFILE_MAGICO, sem o '\0' */
+    int versao;         /* GRAPHFILE_VERSAO */
+    int numVertices;    /* Nmero de registos VerticeFile */
+    int numArestas;     /* Nmero de registos AdjFile */
+} GraphFileHeader;
+
  /**
   * @brief Estrutura para representar um vrtice no ficheiro.
   */
@@ -46,43 +67,66 @@ typedef struct
 typedef struct Graph
 {
     Node* inicioGraph;     
+    Node* fimGraph;             /* ltimo vrtice da lista (maior ID) */
+    HashVertices indice;        /* ndice ID -> vrtice */
+    Node** slots;               /* Posio densa -> vrtice (numeroVertices posies ocupadas) */
+    int capacidadeSlots;        /* Nmero de posies reservadas em slots */
+    Arena arenaVertices;        /* Arena dos vrtices criados pelo grafo */
+    Arena arenaAdjacentes;      /* Arena das adjacncias dos vrtices criados pelo grafo */
+    int verticesExternos;       /* Vrtices inseridos que foram criados com CreateVertice (vrtice e adjacncias com malloc) */
+    bool comEntradas;           /* true se cada vrtice mantm a lista das suas adjacncias de entrada */
     struct Node* nextVertice; 
     int numeroVertices;     
+    int numArestas;             /* Nmero total de adjacncias */
     int totVertices;        
     int id;                
     bool visitado;         
 } Graph;
 
-#define MAX 100
 #define MAXDISTANCE -999999
 
 /**
  * @brief Estrutura para armazenar o melhor caminho.
+ *
+ * Os vetores so indexados pela posio densa dos vrtices (Node::slot) e crescem conforme
+ * o grafo; a mesma estrutura pode ser reutilizada em chamadas sucessivas de BestPath
+ * sem novas alocaes.
  */
 typedef struct {
-    int anteriores[MAX];    
-    int distance[MAX];      
+    int n;                  /* Nmero de vrtices do ltimo clculo */
+    int capacidade;         /* Nmero de posies reservadas em cada vetor */
+    int origem;             /* Posio do vrtice inicial */
+    int* ids;               /* ID do vrtice de cada posio */
+    int* anteriores;        /* Posio do antecessor de cada vrtice no caminho */
+    int* distance;          /* Peso acumulado at cada vrtice (MAXDISTANCE se inalcanvel) */
+    bool* visitados;        /* Vrtices j retirados da fila (uso interno) */
+    DHeap fila;             /* Fila de prioridade dos vrtices por visitar (uso interno) */
 } Best;
 
 /* Prottipos das funes */
 Graph* CreateGraph(int* totV, bool* res);
 Graph* InsertVertGraph(Graph* G, Node* new, bool* res);
+Graph* InsertNewVertGraph(Graph* G, int id, bool* res);
 Graph* InsertAdjaGraph(Graph* G, int idOrigin, int idDestiny, int peso, bool* res);
 Graph* DeleteAdjGraph(Graph* G, int origin, int destiny, bool* res);
-Graph* WhereIsVertGraph(Graph* G, int idVertice);
+Node* WhereIsVertGraph(Graph* G, int idVertice);
 Graph* DeleteVertGraph(Graph* G, int codVertice, bool* res);
+Graph* IncomingEdgesGraph(Graph* G, bool ativo, bool* res);
 bool ExistVertGraph(Graph* inicio, int idVertice);
 bool ShowGraph2(Graph* Gr);
 Graph* DestroyGraph(Graph* G, bool* res);
 Graph* ins_vert_adj(Graph* G, Node2* ini, int* vert, int* adj, bool* res);
 int SaveGraph(Graph* G, char* fileName);
-Graph* LoadGraphB(char* fileName, bool* res);
+Graph* LoadGraphB(const char* fileName, bool* res);
 Node* FindVerticeId(Graph* g, int cod);
 int CountPaths(Graph* g, int src, int dst, int pathCount);
 int CountPathsVertices(Graph* g, int src, int dest);
 bool DepthFirstSearchRec(Graph* g, int origem, int dest);
+bool ReverseDepthFirstSearchRec(Graph* g, int dest, int origem);
 Graph* ResetVerticesVisitados(Graph* g);
-Best BestPath(Graph* g, int n, int v);
-void ShowAllPath(Best b, int n, int v);
+Best* CreateBest(int capacidade, bool* res);
+Best* DestroyBest(Best* b, bool* res);
+bool BestPath(Graph* g, int v, Best* b);
+void ShowAllPath(Best* b);
 
 #endif /* GRAPH_H */
@@ -0,0 +1,220 @@
+/**
+ * @file   HashVertices.c
+ * @author Hugo Lopes_30516
+ *
+ * @brief Implementao da tabela de disperso que indexa os vrtices pelo ID.
+ *
+ * Este ficheiro contm as funes de criao, insero, procura, remoo e libertao
+ * do ndice ID -> vrtice usado pelo grafo.
+ *
+ * @date   Outubro 2026
+ */
+
+#include <stdlib.h>
+#include <malloc.h>
+#include <stdbool.h>
+#include "HashVertices.h"
+
+/* Capacidade mnima da tabela */
+#define HASH_MIN 16
+
+
+#pragma region Calcula a posio inicial de um ID na tabela.
+/**
+ * @brief Calcula a posio inicial de um ID na tabela (disperso multiplicativa).
+ *
+ * @param id O ID do vrtice.
+ * @param capacidade A capacidade da tabela (potncia de 2).
+ * @return A posio inicial de sondagem.
+ */
+static int PosicaoHash(int id, int capacidade)
+{
+    unsigned int h = (unsigned int)id * 2654435769u;
+    h ^= h >> 16;
+    return (int)(h & (unsigned int)(capacidade - 1));
+}
+#pragma endregion
+
+
+#pragma region Cria uma tabela vazia.
+/**
+ * @brief Cria uma tabela vazia com espao para, pelo menos, o nmero de vrtices indicado.
+ *
+ * @param h Apontador para a tabela a inicializar.
+ * @param capacidade Nmero de vrtices esperado (pode ser 0).
+ * @return true se a alocao foi bem-sucedida; false caso contrrio.
+ */
+bool CreateHashVertices(HashVertices* h, int capacidade)
+{
+    if (h == NULL) return false;
+
+    // Mantm o fator de carga abaixo de 1/2
+    int cap = HASH_MIN;
+    while (cap < 2 * capacidade) cap *= 2;
+
+    h->slots = (Node**)calloc(cap, sizeof(Node*));
+    if (h->slots == NULL)
+    {
+        h->capacidade = 0;
+        h->ocupados = 0;
+        return false;
+    }
+
+    h->capacidade = cap;
+    h->ocupados = 0;
+    return true;
+}
+#pragma endregion
+
+
+#pragma region Duplica a capacidade da tabela.
+/**
+ * @brief Duplica a capacidade da tabela, reinserindo todos os vrtices.
+ *
+ * @param h Apontador para a tabela.
+ * @return true se a operao foi bem-sucedida; false caso contrrio (a tabela fica inalterada).
+ */
+static bool CresceHashVertices(HashVertices* h)
+{
+    int novaCap = (h->capacidade > 0) ? h->capacidade * 2 : HASH_MIN;
+    Node** novos = (Node**)calloc(novaCap, sizeof(Node*));
+    if (novos == NULL) return false;
+
+    // Reinsere todos os vrtices na nova tabela
+    for (int i = 0; i < h->capacidade; i++)
+    {
+        Node* v = h->slots[i];
+        if (v == NULL) continue;
+
+        int p = PosicaoHash(v->id, novaCap);
+        while (novos[p] != NULL) p = (p + 1) & (novaCap - 1);
+        novos[p] = v;
+    }
+
+    free(h->slots);
+    h->slots = novos;
+    h->capacidade = novaCap;
+    return true;
+}
+#pragma endregion
+
+
+#pragma region Insere um vrtice na tabela.
+/**
+ * @brief Insere um vrtice na tabela.
+ *
+ * @param h Apontador para a tabela.
+ * @param vertice O vrtice a indexar.
+ * @return true se o vrtice foi inserido; false se j existir um vrtice com o mesmo ID
+ *         ou se a alocao de memria falhar.
+ */
+bool InsertHashVertice(HashVertices* h, Node* vertice)
+{
+    if (h == NULL || vertice == NULL) return false;
+
+    // Cresce a tabela antes de ultrapassar o fator de carga 1/2
+    if (2 * (h->ocupados + 1) > h->capacidade)
+    {
+        if (!CresceHashVertices(h)) return false;
+    }
+
+    int p = PosicaoHash(vertice->id, h->capacidade);
+    while (h->slots[p] != NULL)
+    {
+        // O vrtice j existe na tabela
+        if (h->slots[p]->id == vertice->id) return false;
+        p = (p + 1) & (h->capacidade - 1);
+    }
+
+    h->slots[p] = vertice;
+    h->ocupados++;
+    return true;
+}
+#pragma endregion
+
+
+#pragma region Procura um vrtice na tabela.
+/**
+ * @brief Procura o vrtice com o ID especificado.
+ *
+ * @param h Apontador para a tabela.
+ * @param id O ID a procurar.
+ * @return Um apontador para o vrtice, se existir; NULL caso contrrio.
+ */
+Node* FindHashVertice(HashVertices* h, int id)
+{
+    if (h == NULL || h->capacidade == 0) return NULL;
+
+    int p = PosicaoHash(id, h->capacidade);
+    while (h->slots[p] != NULL)
+    {
+        if (h->slots[p]->id == id) return h->slots[p];
+        p = (p + 1) & (h->capacidade - 1);
+    }
+    return NULL;
+}
+#pragma endregion
+
+
+#pragma region Remove um vrtice da tabela.
+/**
+ * @brief Remove o vrtice com o ID especificado da tabela.
+ *
+ * Usa remoo por deslocamento (backward shift), pelo que no so necessrias
+ * marcas de posies apagadas.
+ *
+ * @param h Apontador para a tabela.
+ * @param id O ID a remover.
+ * @return true se o vrtice foi removido; false se no existia.
+ */
+bool DeleteHashVertice(HashVertices* h, int id)
+{
+    if (h == NULL || h->capacidade == 0) return false;
+
+    int mascara = h->capacidade - 1;
+    int p = PosicaoHash(id, h->capacidade);
+    while (h->slots[p] != NULL && h->slots[p]->id != id)
+        p = (p + 1) & mascara;
+
+    // No existe
+    if (h->slots[p] == NULL) return false;
+
+    // Desloca para trs os elementos seguintes da mesma sequncia de sondagem
+    int livre = p;
+    int i = p;
+    while (true)
+    {
+        i = (i + 1) & mascara;
+        if (h->slots[i] == NULL) break;
+
+        int inicio = PosicaoHash(h->slots[i]->id, h->capacidade);
+        // O elemento s pode ocupar a posio livre se esta estiver entre a sua posio inicial e i
+        if (((i - inicio) & mascara) >= ((i - livre) & mascara))
+        {
+            h->slots[livre] = h->slots[i];
+            livre = i;
+        }
+    }
+    h->slots[livre] = NULL;
+    h->ocupados--;
+    return true;
+}
+#pragma endregion
+
+
+#pragma region Liberta a memria da tabela.
+/**
+ * @brief Liberta a memria da tabela (os vrtices no so libertados).
+ *
+ * @param h Apontador para a tabela.
+ */
+void DestroyHashVertices(HashVertices* h)
+{
+    if (h == NULL) return;
+
+    free(h->slots);
+    h->slots = NULL;
+    h->capacidade = 0;
+    h->ocupados = 0;
+}
+#pragma endregion
@@ -0,0 +1,38 @@
+/**
+ * @file   HashVertices.h
+ * @brief  Definies da tabela de disperso (hash) que indexa os vrtices de um grafo pelo ID.
+ *
+ * A tabela usa endereamento aberto com sondagem linear e permite localizar um vrtice
+ * em tempo constante, sem percorrer a lista ligada de vrtices.
+ *
+ * @date   Outubro 2026
+ * @author Hugo Lopes_30516
+ */
+
+#pragma once
+
+#define _CRT_SECURE_NO_WARNINGS
+
+#ifndef HASHVRT
+#define HASHVRT
+
+#include <stdbool.h>
+#include "Vertices.h"
+
+ /**
+  * @brief Estrutura para representar o ndice ID -> vrtice.
+  */
+typedef struct HashVertices
+{
+    Node** slots;       /* Posies da tabela (NULL = livre) */
+    int capacidade;     /* Nmero de posies (sempre potncia de 2) */
+    int ocupados;       /* Nmero de vrtices indexados */
+} HashVertices;
+
+bool CreateHashVertices(HashVertices* h, int capacidade);
+bool InsertHashVertice(HashVertices* h, Node* vertice);
+Node* FindHashVertice(HashVertices* h, int id);
+bool DeleteHashVertice(HashVertices* h, int id);
+void DestroyHashVertices(HashVertices* h);
+
+#endif /* HASHVRT */
@@ -22,18 +22,40 @@
 #include"Vertices.h"
 #include"VerticesAdjacent.h"
 #include"Graph.h"
+#include"Arena.h"
+#include"MapFile.h"
+#include"EdgeList.h"
+#include"Threads.h"
+#include"CSR.h"
+#include<string.h>
+#include<limits.h>
+
+/* Tamanho do buffer de leitura usado pelo carregamento direto da matriz */
+#define TAM_BUFFER_LEITURA 65536
+
+ /**
+  * @brief Leitor de caracteres com buffer prprio (evita uma chamada  biblioteca por caracter).
+  */
+typedef struct
+{
+    FILE* fp;
+    int pos;
+    int tam;
+    char buffer[TAM_BUFFER_LEITURA];
+} LeitorFicheiro;
 
 #pragma region Cria um novo peso de adjacncia especificado.
  /**
  * Cria um novo n com o peso especificado.
  *
  * @param peso2 O peso do n a ser criado.
+ * @param arena A arena de onde o n  reservado, ou NULL para usar malloc.
  * @return Um apontador para o novo n criado, ou NULL se a alocao de memria falhar.
  */
-Node2* novoNo(int peso2)
+Node2* novoNo(int peso2, Arena* arena)
 {
-    // Aloca memria para o novo n
-    Node2* aux = (Node2*)malloc(sizeof(Node2));
+    // Aloca memria para o novo n (da arena, se existir)
+    Node2* aux = (arena != NULL) ? (Node2*)AllocArena(arena) : (Node2*)malloc(sizeof(Node2));
 
     // Verifica se a alocao de memria foi bem-sucedida
     if (aux == NULL) return NULL;
@@ -56,15 +78,22 @@ Node2* novoNo(int peso2)
  *
  * @param head O apontador para o incio da lista.
  * @param peso2 O apontador para a adja a ser inserido.
+ * @param fim Apontador para o ltimo n da lista, atualizado aps a insero (insero em tempo constante),
+ *            ou NULL para percorrer a lista at ao fim.
  * @return O apontador para o incio da lista aps a insero do novo n.
  */
-Node2* InsereFim(Node2* head, Node2* peso2)
+Node2* InsereFim(Node2* head, Node2* peso2, Node2** fim)
 {
     // Verifica se o n a ser inserido  NULL
     if (peso2 == NULL) return head;
 
     // Se a lista estiver vazia, o n a ser inserido ser o primeiro da lista
-    if (head == NULL) return peso2;
+    if (head == NULL) head = peso2;
+    else if (fim != NULL && *fim != NULL)
+    {
+        // Insere o novo n a seguir ao ltimo n conhecido
+        (*fim)->next = peso2;
+    }
     else 
     {
         // Percorre a lista at o ltimo n
@@ -76,6 +105,9 @@ Node2* InsereFim(Node2* head, Node2* peso2)
         aux->next = peso2;
     }
 
+    // O novo n passa a ser o ltimo
+    if (fim != NULL) *fim = peso2;
+
     // Retorna o apontador para o incio da lista
     return head;
 }
@@ -91,14 +123,17 @@ Node2* InsereFim(Node2* head, Node2* peso2)
  * @param ficheiro O nome do ficheiro a ser lido.
  * @param totV Apontador para a varivel que armazenar o nmero total de vrtices (linhas).
  * @param totA Apontador para a varivel que armazenar o nmero total de adjacncias (colunas).
+ * @param arena Arena de onde os ns da lista so reservados (libertada de uma s vez com DestroyArena
+ *              depois de usar a lista), ou NULL para reservar cada n com malloc.
  * @param res Apontador para uma varivel bool onde ser armazenado o resultado da operao.
  *            Ser definido como verdadeiro se a leitura for bem-sucedida, ou falso caso contrrio.
  * @return Apontador para o incio da lista ligada de ns, ou NULL se a leitura falhar.
  */
-Node2* readFile(const char* ficheiro, int* totV, int* totA, bool* res)
+Node2* readFile(const char* ficheiro, int* totV, int* totA, Arena* arena, bool* res)
 {
     // Inicializa a lista ligada como vazia
     Node2* head = NULL;
+    Node2* fim = NULL; // ltimo n da lista
 
     // Abre o ficheiro para leitura
     FILE* fp = fopen(ficheiro, "r");
@@ -122,12 +157,17 @@ Node2* readFile(const char* ficheiro, int* totV, int* totA, bool* res)
     while (fscanf(fp, "%d%c", &peso2, &delimitador) != EOF)
     {
         // Cria um novo n com o valor lido
-        Node2* novo = novoNo(peso2);
+        Node2* novo = novoNo(peso2, arena);
         if (novo == NULL)
+        {
+            fclose(fp);
+            if (res != NULL)
+                *res = false;
             return NULL;
+        }
 
         // Insere o novo n no final da lista
-        head = InsereFim(head, novo);
+        head = InsereFim(head, novo, &fim);
         (*totA)++;
 
         // Verifica se chegou ao final da linha 
@@ -148,3 +188,951 @@ Node2* readFile(const char* ficheiro, int* totV, int* totA, bool* res)
 #pragma endregion
 
 
+#pragma region L o prximo caracter do ficheiro.
+/**
+ * L o prximo caracter do ficheiro, recarregando o buffer quando este se esgota.
+ *
+ * @param l O leitor.
+ * @return O caracter lido, ou EOF no fim do ficheiro.
+ */
+static int LerCaracter(LeitorFicheiro* l)
+{
+    if (l->pos == l->tam)
+    {
+        l->tam = (int)fread(l->buffer, 1, TAM_BUFFER_LEITURA, l->fp);
+        l->pos = 0;
+        if (l->tam <= 0) return EOF;
+    }
+    return (unsigned char)l->buffer[l->pos++];
+}
+#pragma endregion
+
+
+#pragma region Garante que um vrtice existe no grafo.
+/**
+ * Cria o vrtice com o ID indicado, se ainda no existir no grafo.
+ *
+ * @param G O grafo.
+ * @param id O ID do vrtice.
+ * @return true se o vrtice existe (ou foi criado); false se a criao falhar.
+ */
+static bool GaranteVertice(Graph* G, int id)
+{
+    bool res;
+    if (FindHashVertice(&G->indice, id) != NULL) return true;
+    InsertNewVertGraph(G, id, &res);
+    return res;
+}
+#pragma endregion
+
+
+#pragma region L uma matriz de um ficheiro diretamente para um grafo.
+/**
+ * L uma matriz de adjacncias de um ficheiro e constri o grafo numa s passagem,
+ * sem a lista intermdia de Node2.
+ *
+ * Cada linha representa o vrtice de origem e cada coluna o vrtice de destino;
+ * as clulas diferentes de zero so inseridas logo como adjacncias. Os nmeros so
+ * lidos atravs de um buffer de tamanho fixo, pelo que a memria usada alm do grafo
+ * no depende do tamanho da matriz. So criados max(linhas, colunas) vrtices, tal como
+ * em ins_vert_adj. As linhas vazias so ignoradas e os separadores aceites so espaos,
+ * tabulaes, ',' e ';' (o '\r' das linhas terminadas em "\r\n" tambm  ignorado).
+ *
+ * @param ficheiro O nome do ficheiro a ser lido.
+ * @param totV Apontador para a varivel que armazenar o nmero de linhas da matriz.
+ * @param totA Apontador para a varivel que armazenar o nmero de colunas da matriz (a maior linha).
+ * @param res Apontador para uma varivel bool onde ser armazenado o resultado da operao.
+ * @return Apontador para o grafo criado, ou NULL se a leitura falhar.
+ */
+Graph* readFileGraph(const char* ficheiro, int* totV, int* totA, bool* res)
+{
+    *res = false;
+    *totV = 0;
+    *totA = 0;
+
+    // Abre o ficheiro para leitura
+    FILE* fp = fopen(ficheiro, "rb");
+    if (fp == NULL) return NULL;
+
+    LeitorFicheiro* leitor = (LeitorFicheiro*)malloc(sizeof(LeitorFicheiro));
+    if (leitor == NULL)
+    {
+        fclose(fp);
+        return NULL;
+    }
+    leitor->fp = fp;
+    leitor->pos = 0;
+    leitor->tam = 0;
+
+    // Cria o grafo (o ndice e as arenas crescem  medida que os vrtices so criados)
+    int inicial = 16;
+    Graph* G = CreateGraph(&inicial, res);
+    if (G == NULL)
+    {
+        free(leitor);
+        fclose(fp);
+        return NULL;
+    }
+
+    int linha = 0, coluna = 0;
+    bool ok = true;
+    int c = LerCaracter(leitor);
+    while (ok && c != EOF)
+    {
+        if (c == '-' || c == '+' || (c >= '0' && c <= '9'))
+        {
+            // L um nmero inteiro
+            bool negativo = (c == '-');
+            bool temDigitos = false;
+            int valor = 0;
+            if (c == '-' || c == '+') c = LerCaracter(leitor);
+            while (c >= '0' && c <= '9')
+            {
+                // Um valor que no cabe num int torna o ficheiro invlido
+                if (valor > (INT_MAX - (c - '0')) / 10)
+                {
+                    ok = false;
+                    break;
+                }
+                valor = valor * 10 + (c - '0');
+                temDigitos = true;
+                c = LerCaracter(leitor);
+            }
+            if (!ok || !temDigitos)
+            {
+                ok = false;
+                break;
+            }
+            if (negativo) valor = -valor;
+
+            // Garante que existem os vrtices de origem (linha) e de destino (coluna)
+            if (coluna == 0) ok = GaranteVertice(G, linha);
+            if (ok) ok = GaranteVertice(G, coluna);
+
+            // Insere a adjacncia (as clulas a zero no so adjacncias)
+            if (ok && valor != 0)
+            {
+                G = InsertAdjaGraph(G, linha, coluna, valor, res);
+                ok = *res;
+            }
+            coluna++;
+            continue; // c j contm o caracter seguinte ao nmero
+        }
+
+        if (c == '\n')
+        {
+            // Fim de linha: s conta se a linha tiver nmeros
+            if (coluna > 0)
+            {
+                if (coluna > *totA) *totA = coluna;
+                linha++;
+            }
+            coluna = 0;
+        }
+        else if (c != ' ' && c != '\t' && c != '\r' && c != ',' && c != ';')
+        {
+            ok = false; // Caracter invlido
+            break;
+        }
+        c = LerCaracter(leitor);
+    }
+
+    // ltima linha sem '\n' no fim do ficheiro
+    if (ok && coluna > 0)
+    {
+        if (coluna > *totA) *totA = coluna;
+        linha++;
+    }
+
+    free(leitor);
+    fclose(fp);
+
+    // Matriz invlida ou vazia
+    if (!ok || linha == 0)
+    {
+        G = DestroyGraph(G, res);
+        *res = false;
+        return NULL;
+    }
+
+    *totV = linha;
+    G->totVertices = G->numeroVertices;
+    *res = true;
+    return G;
+}
+#pragma endregion
+
+
+#pragma region Percorre uma matriz em texto, linha a linha.
+/**
+ * Percorre o texto de uma matriz (por exemplo, um ficheiro mapeado em memria) e chama
+ * a funo indicada para cada linha no vazia, com os valores j convertidos em inteiros.
+ *
+ * O fim de cada linha  localizado com memchr (vetorizada na biblioteca de C) e os nmeros
+ * so convertidos por um ciclo prprio, sem scanf. So aceites linhas terminadas em "\n"
+ * ou "\r\n", espaos no fim das linhas, linhas vazias (ignoradas) e a ausncia de "\n"
+ * na ltima linha. Os separadores aceites so espaos, tabulaes, ',' e ';'.
+ *
+ * @param inicio Incio do texto.
+ * @param fim Fim do texto (posio a seguir ao ltimo caracter).
+ * @param f Funo chamada para cada linha.
+ * @param contexto Apontador passado a f.
+ * @param linhas Apontador para a varivel que armazenar o nmero de linhas no vazias.
+ * @param colunas Apontador para a varivel que armazenar o nmero de valores da maior linha.
+ * @return true se todo o texto foi lido; false se existir um caracter invlido,
+ *         se faltar memria ou se f interromper a leitura.
+ */
+bool ScanMatrixText(const char* inicio, const char* fim, LinhaMatriz f, void* contexto, int* linhas, int* colunas)
+{
+    *linhas = 0;
+    *colunas = 0;
+
+    // Vetor com os valores da linha atual (cresce se a linha for maior)
+    int capacidade = 1024;
+    int* valores = (int*)malloc(capacidade * sizeof(int));
+    if (valores == NULL) return false;
+
+    bool ok = true;
+    const char* p = inicio;
+    while (ok && p < fim)
+    {
+        // Localiza o fim da linha
+        const char* fimLinha = (const char*)memchr(p, '\n', (size_t)(fim - p));
+        if (fimLinha == NULL) fimLinha = fim;
+
+        // Converte os nmeros da linha
+        int n = 0;
+        while (p < fimLinha)
+        {
+            char c = *p;
+            if (c == ' ' || c == '\t' || c == '\r' || c == ',' || c == ';')
+            {
+                p++;
+                continue;
+            }
+
+            bool negativo = false;
+            if (c == '-' || c == '+')
+            {
+                negativo = (c == '-');
+                p++;
+            }
+            if (p >= fimLinha || (unsigned)(*p - '0') > 9)
+            {
+                ok = false; // Caracter invlido
+                break;
+            }
+
+            int valor = 0;
+            while (p < fimLinha && (unsigned)(*p - '0') <= 9)
+            {
+                // Um valor que no cabe num int torna o ficheiro invlido
+                if (valor > (INT_MAX - (*p - '0')) / 10)
+                {
+                    ok = false;
+                    break;
+                }
+                valor = valor * 10 + (*p - '0');
+                p++;
+            }
+            if (!ok) break;
+
+            // Aumenta o vetor da linha, se necessrio
+            if (n == capacidade)
+            {
+                int* novo = (int*)realloc(valores, 2 * capacidade * sizeof(int));
+                if (novo == NULL)
+                {
+                    ok = false;
+                    break;
+                }
+                valores = novo;
+                capacidade *= 2;
+            }
+            valores[n++] = negativo ? -valor : valor;
+        }
+
+        // Entrega a linha, se no estiver vazia
+        if (ok && n > 0)
+        {
+            ok = f(contexto, *linhas, valores, n);
+            (*linhas)++;
+            if (n > *colunas) *colunas = n;
+        }
+        p = fimLinha + 1;
+    }
+
+    free(valores);
+    return ok;
+}
+#pragma endregion
+
+
+ /**
+  * @brief Contexto da construo de um grafo a partir das linhas de uma matriz.
+  */
+typedef struct
+{
+    Graph* G;
+    int colunasCriadas; /* Os vrtices 0 .. colunasCriadas-1 j existem */
+} ContextoMatriz;
+
+
+#pragma region Insere uma linha da matriz no grafo.
+/**
+ * Insere no grafo as adjacncias de uma linha da matriz (funo do tipo LinhaMatriz).
+ *
+ * @param contexto O ContextoMatriz da leitura.
+ * @param linha O ndice da linha (vrtice de origem).
+ * @param valores Os pesos da linha (um por vrtice de destino).
+ * @param numValores O nmero de valores da linha.
+ * @return true se a linha foi inserida; false se faltar memria.
+ */
+static bool InsereLinhaMatriz(void* contexto, int linha, const int* valores, int numValores)
+{
+    ContextoMatriz* ctx = (ContextoMatriz*)contexto;
+    Graph* G = ctx->G;
+    bool res;
+
+    // Cria os vrtices das colunas que ainda no existem e o vrtice da linha
+    for (; ctx->colunasCriadas < numValores; ctx->colunasCriadas++)
+    {
+        if (!GaranteVertice(G, ctx->colunasCriadas)) return false;
+    }
+    if (!GaranteVertice(G, linha)) return false;
+
+    // Insere as adjacncias diretamente no fim da lista do vrtice de origem
+    Node* origem = FindHashVertice(&G->indice, linha);
+    for (int j = 0; j < numValores; j++)
+    {
+        if (valores[j] == 0) continue;
+
+        InsertAdjVertice(origem, j, valores[j], &G->arenaAdjacentes, &res);
+        if (!res) return false;
+        G->numArestas++;
+    }
+    return true;
+}
+#pragma endregion
+
+
+#pragma region L uma matriz de um ficheiro mapeado em memria para um grafo.
+/**
+ * L uma matriz de adjacncias mapeando o ficheiro em memria e constri o grafo diretamente.
+ *
+ * Tem o mesmo resultado que readFileGraph, mas o ficheiro no  copiado para buffers:
+ * o texto  lido diretamente das pginas mapeadas com ScanMatrixText.
+ *
+ * @param ficheiro O nome do ficheiro a ser lido.
+ * @param totV Apontador para a varivel que armazenar o nmero de linhas da matriz.
+ * @param totA Apontador para a varivel que armazenar o nmero de colunas da matriz (a maior linha).
+ * @param res Apontador para uma varivel bool onde ser armazenado o resultado da operao.
+ * @return Apontador para o grafo criado, ou NULL se a leitura falhar.
+ */
+Graph* readFileGraphMap(const char* ficheiro, int* totV, int* totA, bool* res)
+{
+    *res = false;
+    *totV = 0;
+    *totA = 0;
+
+    MapFile mapa;
+    if (!OpenMapFile(&mapa, ficheiro)) return NULL;
+
+    // Cria o grafo (o ndice e as arenas crescem  medida que os vrtices so criados)
+    int inicial = 16;
+    Graph* G = CreateGraph(&inicial, res);
+    if (G == NULL)
+    {
+        CloseMapFile(&mapa);
+        return NULL;
+    }
+
+    ContextoMatriz ctx = { G, 0 };
+    int linhas, colunas;
+    bool ok = ScanMatrixText(mapa.dados, mapa.dados + mapa.tamanho, InsereLinhaMatriz, &ctx, &linhas, &colunas);
+    CloseMapFile(&mapa);
+
+    // Matriz invlida ou vazia
+    if (!ok || linhas == 0)
+    {
+        G = DestroyGraph(G, res);
+        *res = false;
+        return NULL;
+    }
+
+    *totV = linhas;
+    *totA = colunas;
+    G->totVertices = G->numeroVertices;
+    *res = true;
+    return G;
+}
+#pragma endregion
+
+
+ /**
+  * @brief Parte de uma matriz lida por uma thread (linhas completas) e as arestas encontradas.
+  */
+typedef struct
+{
+    const char* inicio;     /* Incio do texto da parte */
+    const char* fim;        /* Fim do texto da parte */
+    EdgeBuffer arestas;     /* Arestas (linha local, coluna, peso) */
+    int linhas;             /* Nmero de linhas no vazias da parte */
+    int colunas;            /* Nmero de valores da maior linha da parte */
+    bool ok;                /* Resultado da leitura */
+} ParteMatriz;
+
+
+#pragma region Guarda as adjacncias de uma linha na lista da parte.
+/**
+ * Acrescenta as clulas diferentes de zero de uma linha  lista de arestas da parte
+ * (funo do tipo LinhaMatriz). A origem guardada  o nmero da linha dentro da parte.
+ */
+static bool GuardaLinhaMatriz(void* contexto, int linha, const int* valores, int numValores)
+{
+    ParteMatriz* parte = (ParteMatriz*)contexto;
+    for (int j = 0; j < numValores; j++)
+    {
+        if (valores[j] != 0 && !PushEdgeBuffer(&parte->arestas, linha, j, valores[j])) return false;
+    }
+    return true;
+}
+#pragma endregion
+
+
+#pragma region L uma parte da matriz (tarefa de uma thread).
+/**
+ * L as linhas de uma parte da matriz para a lista de arestas da parte (tarefa do tipo TarefaThread).
+ */
+static void LeParteMatriz(void* argumento)
+{
+    ParteMatriz* parte = (ParteMatriz*)argumento;
+
+    // Estimativa inicial: uma aresta por cada 16 bytes de texto
+    parte->ok = CreateEdgeBuffer(&parte->arestas, (int)((parte->fim - parte->inicio) / 16));
+    if (parte->ok)
+        parte->ok = ScanMatrixText(parte->inicio, parte->fim, GuardaLinhaMatriz, parte, &parte->linhas, &parte->colunas);
+}
+#pragma endregion
+
+
+#pragma region L uma matriz em paralelo para listas de arestas.
+/**
+ * Mapeia o ficheiro, divide-o em partes com linhas completas (uma por thread) e l-as em paralelo.
+ * No fim, as origens das arestas de cada parte so convertidas no nmero global da linha,
+ * pelo que a ordem das linhas do ficheiro  mantida.
+ *
+ * @param ficheiro O nome do ficheiro.
+ * @param numThreads O nmero de threads (<= 0 usa um por processador).
+ * @param partes Apontador que recebe o vetor de partes (a libertar com LibertaPartesMatriz).
+ * @param numPartes Apontador que recebe o nmero de partes.
+ * @param linhas Apontador que recebe o nmero total de linhas no vazias.
+ * @param colunas Apontador que recebe o nmero de valores da maior linha.
+ * @return true se todo o ficheiro foi lido; false caso contrrio.
+ */
+static bool LeMatrizParalela(const char* ficheiro, int numThreads, ParteMatriz** partes, int* numPartes, int* linhas, int* colunas)
+{
+    *partes = NULL;
+    *numPartes = 0;
+    *linhas = 0;
+    *colunas = 0;
+
+    MapFile mapa;
+    if (!OpenMapFile(&mapa, ficheiro)) return false;
+
+    // No vale a pena dividir ficheiros pequenos (menos de 64 KB por parte)
+    int n = ThreadCount(numThreads);
+    while (n > 1 && mapa.tamanho / (size_t)n < 65536) n--;
+
+    ParteMatriz* p = (ParteMatriz*)calloc(n, sizeof(ParteMatriz));
+    if (p == NULL)
+    {
+        CloseMapFile(&mapa);
+        return false;
+    }
+
+    // Divide o texto em partes que comeam sempre no incio de uma linha
+    const char* fimTexto = mapa.dados + mapa.tamanho;
+    const char* inicio = mapa.dados;
+    for (int i = 0; i < n; i++)
+    {
+        const char* fim = fimTexto;
+        if (i < n - 1)
+        {
+            fim = mapa.dados + mapa.tamanho / (size_t)n * (size_t)(i + 1);
+            if (fim < inicio) fim = inicio;
+            const char* nl = (const char*)memchr(fim, '\n', (size_t)(fimTexto - fim));
+            fim = (nl != NULL) ? nl + 1 : fimTexto;
+        }
+        p[i].inicio = inicio;
+        p[i].fim = fim;
+        inicio = fim;
+    }
+
+    // L as partes em paralelo
+    RunThreads(n, LeParteMatriz, p, sizeof(ParteMatriz));
+    CloseMapFile(&mapa);
+
+    // Converte as linhas locais em linhas globais
+    bool ok = true;
+    int base = 0;
+    for (int i = 0; i < n; i++)
+    {
+        ok = ok && p[i].ok;
+        for (int e = 0; e < p[i].arestas.numArestas; e++) p[i].arestas.origens[e] += base;
+        base += p[i].linhas;
+        if (p[i].colunas > *colunas) *colunas = p[i].colunas;
+    }
+    *linhas = base;
+
+    *partes = p;
+    *numPartes = n;
+    return ok;
+}
+#pragma endregion
+
+
+#pragma region Liberta as partes lidas em paralelo.
+/**
+ * Liberta as listas de arestas e o vetor de partes criados por LeMatrizParalela.
+ */
+static void LibertaPartesMatriz(ParteMatriz* partes, int numPartes)
+{
+    if (partes == NULL) return;
+    for (int i = 0; i < numPartes; i++) DestroyEdgeBuffer(&partes[i].arestas);
+    free(partes);
+}
+#pragma endregion
+
+
+#pragma region L uma matriz em paralelo para um grafo.
+/**
+ * L uma matriz de adjacncias com vrias threads e constri o grafo.
+ *
+ * O ficheiro  mapeado em memria e dividido em partes com linhas completas, que so lidas
+ * em paralelo para listas de arestas prprias de cada thread. As listas so depois juntadas
+ * no grafo pela ordem das linhas, pelo que o resultado  igual ao de readFileGraph.
+ *
+ * @param ficheiro O nome do ficheiro a ser lido.
+ * @param numThreads O nmero de threads (<= 0 usa um por processador).
+ * @param totV Apontador para a varivel que armazenar o nmero de linhas da matriz.
+ * @param totA Apontador para a varivel que armazenar o nmero de colunas da matriz (a maior linha).
+ * @param res Apontador para uma varivel bool onde ser armazenado o resultado da operao.
+ * @return Apontador para o grafo criado, ou NULL se a leitura falhar.
+ */
+Graph* readFileGraphParallel(const char* ficheiro, int numThreads, int* totV, int* totA, bool* res)
+{
+    *res = false;
+    *totV = 0;
+    *totA = 0;
+
+    ParteMatriz* partes;
+    int numPartes, linhas, colunas;
+    if (!LeMatrizParalela(ficheiro, numThreads, &partes, &numPartes, &linhas, &colunas) || linhas == 0)
+    {
+        LibertaPartesMatriz(partes, numPartes);
+        return NULL;
+    }
+
+    // Cria os vrtices 0 .. max(linhas, colunas)-1 por ordem (insero no fim da lista)
+    int numV = (linhas > colunas) ? linhas : colunas;
+    Graph* G = CreateGraph(&numV, res);
+    for (int i = 0; G != NULL && *res && i < numV; i++) G = InsertNewVertGraph(G, i, res);
+
+    // Junta as arestas de cada parte, pela ordem das linhas
+    Node* origem = NULL;
+    for (int p = 0; G != NULL && *res && p < numPartes; p++)
+    {
+        EdgeBuffer* b = &partes[p].arestas;
+        for (int e = 0; e < b->numArestas && *res; e++)
+        {
+            if (origem == NULL || origem->id != b->origens[e]) origem = FindHashVertice(&G->indice, b->origens[e]);
+            InsertAdjVertice(origem, b->destinos[e], b->pesos[e], &G->arenaAdjacentes, res);
+            if (*res) G->numArestas++;
+        }
+    }
+    LibertaPartesMatriz(partes, numPartes);
+
+    if (G == NULL || !*res)
+    {
+        if (G != NULL) DestroyGraph(G, res);
+        *res = false;
+        return NULL;
+    }
+
+    *totV = linhas;
+    *totA = colunas;
+    return G;
+}
+#pragma endregion
+
+
+#pragma region L uma matriz em paralelo diretamente para uma estrutura CSR.
+/**
+ * L uma matriz de adjacncias com vrias threads e constri diretamente a estrutura CSR,
+ * sem passar pelas listas ligadas do grafo. Os vrtices so 0 .. max(linhas, colunas)-1.
+ *
+ * @param ficheiro O nome do ficheiro a ser lido.
+ * @param numThreads O nmero de threads (<= 0 usa um por processador).
+ * @param totV Apontador para a varivel que armazenar o nmero de linhas da matriz.
+ * @param totA Apontador para a varivel que armazenar o nmero de colunas da matriz (a maior linha).
+ * @param res Apontador para uma varivel bool onde ser armazenado o resultado da operao.
+ * @return Apontador para a estrutura CSR criada, ou NULL se a leitura falhar.
+ */
+CSR* readFileCSRParallel(const char* ficheiro, int numThreads, int* totV, int* totA, bool* res)
+{
+    *res = false;
+    *totV = 0;
+    *totA = 0;
+
+    ParteMatriz* partes;
+    int numPartes, linhas, colunas;
+    if (!LeMatrizParalela(ficheiro, numThreads, &partes, &numPartes, &linhas, &colunas) || linhas == 0)
+    {
+        LibertaPartesMatriz(partes, numPartes);
+        return NULL;
+    }
+
+    // As listas de arestas das partes so passadas diretamente ao construtor da estrutura CSR
+    int numV = (linhas > colunas) ? linhas : colunas;
+    EdgeBuffer* listas = (EdgeBuffer*)malloc(numPartes * sizeof(EdgeBuffer));
+    CSR* c = NULL;
+    if (listas != NULL)
+    {
+        for (int p = 0; p < numPartes; p++) listas[p] = partes[p].arestas;
+        c = CreateCSRFromEdges(listas, numPartes, numV, NULL, res);
+        free(listas);
+    }
+    LibertaPartesMatriz(partes, numPartes);
+
+    if (c == NULL)
+    {
+        *res = false;
+        return NULL;
+    }
+
+    *totV = linhas;
+    *totA = colunas;
+    return c;
+}
+#pragma endregion
+
+
+#pragma region L um inteiro de um texto.
+/**
+ * L um inteiro (com sinal opcional) a partir de p, ignorando os separadores anteriores
+ * (espaos, tabulaes, '\r', ',' e ';').
+ *
+ * @param p Apontador para a posio atual; avana para depois do nmero.
+ * @param fim Fim da linha.
+ * @param valor Apontador que recebe o nmero lido.
+ * @return 1 se foi lido um nmero, 0 se a linha terminou, -1 se existir um caracter invlido
+ *         ou o nmero no couber num int.
+ */
+static int LeInteiroTexto(const char** p, const char* fim, int* valor)
+{
+    const char* q = *p;
+    while (q < fim && (*q == ' ' || *q == '\t' || *q == '\r' || *q == ',' || *q == ';')) q++;
+    if (q == fim)
+    {
+        *p = q;
+        return 0;
+    }
+
+    bool negativo = false;
+    if (*q == '-' || *q == '+')
+    {
+        negativo = (*q == '-');
+        q++;
+    }
+    if (q >= fim || (unsigned)(*q - '0') > 9) return -1;
+
+    int v = 0;
+    while (q < fim && (unsigned)(*q - '0') <= 9)
+    {
+        // Um valor que no cabe num int torna a linha invlida
+        if (v > (INT_MAX - (*q - '0')) / 10) return -1;
+        v = v * 10 + (*q - '0');
+        q++;
+    }
+
+    *valor = negativo ? -v : v;
+    *p = q;
+    return 1;
+}
+#pragma endregion
+
+
+#pragma region L uma lista de arestas em texto.
+/**
+ * L as arestas de um texto com uma aresta por linha: "origem destino peso".
+ *
+ * O peso  opcional (vale 1 quando falta) e as arestas com peso 0 so ignoradas,
+ * tal como as clulas a zero da matriz. As linhas comeadas por '#' ou '%' so comentrios;
+ * se o primeiro comentrio, antes de qualquer aresta, tiver dois nmeros ("# V E"), o nmero
+ * de arestas (limitado ao que o tamanho do texto permite)  usado para reservar a memria da
+ * lista de uma s vez, e o nmero de vrtices 
+ * apenas devolvido (os vrtices do grafo so sempre contados a partir das arestas).
+ *
+ * @param inicio Incio do texto.
+ * @param fim Fim do texto.
+ * @param b A lista de arestas (ainda no criada) que recebe as arestas.
+ * @param numVertices Apontador que recebe o nmero de vrtices indicado no cabealho (0 se no existir).
+ * @return true se todo o texto foi lido; false se existir uma linha invlida ou faltar memria.
+ */
+static bool LeArestasTexto(const char* inicio, const char* fim, EdgeBuffer* b, int* numVertices)
+{
+    *numVertices = 0;
+
+    // Procura o cabealho com as indicaes de tamanho
+    const char* p = inicio;
+    while (p < fim && (*p == ' ' || *p == '\t' || *p == '\r' || *p == '\n')) p++;
+    int numArestas = (int)((fim - inicio) / 12); // Sem cabealho: estimativa de 12 bytes por aresta
+    if (p < fim && *p == '#')
+    {
+        const char* fimLinha = (const char*)memchr(p, '\n', (size_t)(fim - p));
+        if (fimLinha == NULL) fimLinha = fim;
+        const char* q = p + 1;
+        int v, a;
+        if (LeInteiroTexto(&q, fimLinha, &v) == 1 && LeInteiroTexto(&q, fimLinha, &a) == 1 && v >= 0 && a >= 0)
+        {
+            *numVertices = v;
+            numArestas = a;
+        }
+    }
+
+    // A indicao do cabealho no pode pedir mais arestas do que cabem no ficheiro (a linha
+    // mais curta, "0 1\n", ocupa 4 bytes); se as arestas forem mais, a lista cresce
+    long long maxArestas = (long long)(fim - inicio) / 4 + 1;
+    if (numArestas > maxArestas) numArestas = (int)maxArestas;
+    if (!CreateEdgeBuffer(b, numArestas)) return false;
+
+    bool ok = true;
+    while (ok && p < fim)
+    {
+        const char* fimLinha = (const char*)memchr(p, '\n', (size_t)(fim - p));
+        if (fimLinha == NULL) fimLinha = fim;
+
+        // Linha de comentrio
+        const char* q = p;
+        while (q < fimLinha && (*q == ' ' || *q == '\t')) q++;
+        if (q < fimLinha && (*q == '#' || *q == '%'))
+        {
+            p = fimLinha + 1;
+            continue;
+        }
+
+        int valores[3];
+        int n = 0, r = 0;
+        while (n < 3 && (r = LeInteiroTexto(&q, fimLinha, &valores[n])) == 1) n++;
+        if (r == 1) r = LeInteiroTexto(&q, fimLinha, &valores[0]); // Tem de terminar aqui
+
+        if (r != 0 || n == 1) ok = false;  // Caracter invlido, valores a mais ou a menos
+        else if (n >= 2)
+        {
+            int peso = (n == 3) ? valores[2] : 1;
+            if (peso != 0) ok = PushEdgeBuffer(b, valores[0], valores[1], peso);
+        }
+        p = fimLinha + 1;
+    }
+    return ok;
+}
+#pragma endregion
+
+
+#pragma region L uma lista de arestas em formato binrio.
+/**
+ * L as arestas de um ficheiro binrio escrito por SaveEdgeBuffer (EdgeListHeader seguido
+ * dos vetores de origens, destinos e pesos), copiando cada vetor de uma s vez. As arestas
+ * com peso 0 so retiradas, tal como na leitura em texto.
+ *
+ * @param dados O contedo do ficheiro.
+ * @param tamanho O tamanho do ficheiro.
+ * @param b A lista de arestas (ainda no criada) que recebe as arestas.
+ * @param numVertices Apontador que recebe o nmero de vrtices indicado no cabealho.
+ * @return true se o ficheiro  vlido; false caso contrrio.
+ */
+static bool LeArestasBinario(const char* dados, size_t tamanho, EdgeBuffer* b, int* numVertices)
+{
+    EdgeListHeader cab;
+    memcpy(&cab, dados, sizeof(cab));
+    if (cab.versao != EDGELIST_VERSAO || cab.numArestas < 0 ||
+        tamanho != sizeof(cab) + 3 * (size_t)cab.numArestas * sizeof(int)) return false;
+
+    if (!CreateEdgeBuffer(b, cab.numArestas)) return false;
+
+    // Os vetores do ficheiro tm o mesmo formato que os da lista
+    size_t n = (size_t)cab.numArestas;
+    const char* vetores = dados + sizeof(cab);
+    memcpy(b->origens, vetores, n * sizeof(int));
+    memcpy(b->destinos, vetores + n * sizeof(int), n * sizeof(int));
+    memcpy(b->pesos, vetores + 2 * n * sizeof(int), n * sizeof(int));
+
+    // Retira as arestas com peso 0, mantendo a ordem das restantes
+    int k = 0;
+    for (int e = 0; e < cab.numArestas; e++)
+    {
+        if (b->pesos[e] == 0) continue;
+        b->origens[k] = b->origens[e];
+        b->destinos[k] = b->destinos[e];
+        b->pesos[k] = b->pesos[e];
+        k++;
+    }
+    b->numArestas = k;
+
+    *numVertices = (cab.numVertices > 0) ? cab.numVertices : 0;
+    return true;
+}
+#pragma endregion
+
+
+#pragma region L uma lista de arestas de um ficheiro.
+/**
+ * L uma lista de arestas de um ficheiro em texto ("origem destino peso" por linha) ou
+ * no formato binrio de SaveEdgeBuffer. O formato  reconhecido pelo incio do ficheiro,
+ * que  mapeado em memria.
+ *
+ * @param ficheiro O nome do ficheiro.
+ * @param b A lista de arestas (ainda no criada) que recebe as arestas; a libertar com DestroyEdgeBuffer.
+ * @param numVertices Apontador que recebe o nmero de vrtices indicado no cabealho (0 se no existir);
+ *         apenas informativo e no  usado para reservar memria.
+ * @return true se o ficheiro foi lido; false caso contrrio (b fica vazia).
+ */
+bool ReadEdgeList(const char* ficheiro, EdgeBuffer* b, int* numVertices)
+{
+    memset(b, 0, sizeof(EdgeBuffer));
+    *numVertices = 0;
+
+    MapFile mapa;
+    if (!OpenMapFile(&mapa, ficheiro)) return false;
+
+    bool ok;
+    if (mapa.tamanho >= sizeof(EdgeListHeader) && memcmp(mapa.dados, EDGELIST_MAGICO, 4) == 0)
+        ok = LeArestasBinario(mapa.dados, mapa.tamanho, b, numVertices);
+    else
+        ok = LeArestasTexto(mapa.dados, mapa.dados + mapa.tamanho, b, numVertices);
+    CloseMapFile(&mapa);
+
+    if (!ok) DestroyEdgeBuffer(b);
+    return ok;
+}
+#pragma endregion
+
+
+#pragma region L uma lista de arestas para um grafo.
+/**
+ * L uma lista de arestas (texto ou binrio, ver ReadEdgeList) e constri o grafo.
+ *
+ * Ao contrrio da matriz, s existem os vrtices que aparecem nas arestas, com os IDs do ficheiro;
+ * estes so criados por ordem crescente (insero no fim da lista) e as adjacncias de cada vrtice
+ * ficam pela ordem do ficheiro.
+ *
+ * @param ficheiro O nome do ficheiro a ser lido.
+ * @param totV Apontador para a varivel que armazenar o nmero de vrtices.
+ * @param totA Apontador para a varivel que armazenar o nmero de arestas.
+ * @param res Apontador para uma varivel bool onde ser armazenado o resultado da operao.
+ * @return Apontador para o grafo criado, ou NULL se a leitura falhar.
+ */
+Graph* readFileEdgesGraph(const char* ficheiro, int* totV, int* totA, bool* res)
+{
+    *res = false;
+    *totV = 0;
+    *totA = 0;
+
+    EdgeBuffer b;
+    int indicacao, numV;
+    if (!ReadEdgeList(ficheiro, &b, &indicacao)) return NULL;
+
+    int* ids = SortedIdsEdgeBuffer(&b, &numV);
+    if (ids == NULL || numV == 0)
+    {
+        free(ids);
+        DestroyEdgeBuffer(&b);
+        return NULL;
+    }
+
+    // Cria os vrtices por ordem crescente de ID
+    Graph* G = CreateGraph(&numV, res);
+    for (int i = 0; G != NULL && *res && i < numV; i++) G = InsertNewVertGraph(G, ids[i], res);
+    free(ids);
+
+    // Insere as adjacncias (a origem anterior  reaproveitada nas arestas seguidas do mesmo vrtice)
+    Node* origem = NULL;
+    for (int e = 0; G != NULL && *res && e < b.numArestas; e++)
+    {
+        if (origem == NULL || origem->id != b.origens[e]) origem = FindHashVertice(&G->indice, b.origens[e]);
+        InsertAdjVertice(origem, b.destinos[e], b.pesos[e], &G->arenaAdjacentes, res);
+        if (*res) G->numArestas++;
+    }
+    DestroyEdgeBuffer(&b);
+
+    if (G == NULL || !*res)
+    {
+        if (G != NULL) DestroyGraph(G, res);
+        *res = false;
+        return NULL;
+    }
+
+    *totV = G->numeroVertices;
+    *totA = G->numArestas;
+    G->totVertices = G->numeroVertices;
+    return G;
+}
+#pragma endregion
+
+
+#pragma region L uma lista de arestas diretamente para uma estrutura CSR.
+/**
+ * L uma lista de arestas (texto ou binrio, ver ReadEdgeList) e constri diretamente
+ * a estrutura CSR. Os IDs do ficheiro so convertidos nos ndices densos 0 .. numVertices-1
+ * por ordem crescente, e continuam disponveis no vetor ids da estrutura.
+ *
+ * @param ficheiro O nome do ficheiro a ser lido.
+ * @param totV Apontador para a varivel que armazenar o nmero de vrtices.
+ * @param totA Apontador para a varivel que armazenar o nmero de arestas.
+ * @param res Apontador para uma varivel bool onde ser armazenado o resultado da operao.
+ * @return Apontador para a estrutura CSR criada, ou NULL se a leitura falhar.
+ */
+CSR* readFileEdgesCSR(const char* ficheiro, int* totV, int* totA, bool* res)
+{
+    *res = false;
+    *totV = 0;
+    *totA = 0;
+
+    EdgeBuffer b;
+    int indicacao, numV;
+    if (!ReadEdgeList(ficheiro, &b, &indicacao)) return NULL;
+
+    int* ids = SortedIdsEdgeBuffer(&b, &numV);
+    if (ids == NULL || numV == 0)
+    {
+        free(ids);
+        DestroyEdgeBuffer(&b);
+        return NULL;
+    }
+
+    // Converte os IDs em ndices densos (pesquisa binria no vetor ordenado)
+    CSR aux = { 0 };
+    aux.numVertices = numV;
+    aux.ids = ids;
+    for (int e = 0; e < b.numArestas; e++)
+    {
+        b.origens[e] = IndexCSR(&aux, b.origens[e]);
+        b.destinos[e] = IndexCSR(&aux, b.destinos[e]);
+    }
+
+    CSR* c = CreateCSRFromEdges(&b, 1, numV, ids, res);
+    free(ids);
+    DestroyEdgeBuffer(&b);
+
+    if (c == NULL)
+    {
+        *res = false;
+        return NULL;
+    }
+
+    *totV = c->numVertices;
+    *totA = c->numArestas;
+    return c;
+}
+#pragma endregion
@@ -17,6 +17,9 @@
 #ifndef IN_OUT
 #define IN_OUT
 
+#include <stdbool.h>
+#include "Arena.h"
+
  /**
    * @brief Estrutura para representar criao de uma lista ligada, atravs da leitura de um ficheiro.
    */
@@ -27,8 +30,30 @@ typedef struct Node2
     struct Node2* next;
 } Node2;
 
-Node2* novoNo(int peso2);
-Node2* InsereFim(Node2* head, Node2* peso2);
-Node2* readFile(const char* ficheiro, int* totV, int* totA, bool* res);
+Node2* novoNo(int peso2, Arena* arena);
+Node2* InsereFim(Node2* head, Node2* peso2, Node2** fim);
+Node2* readFile(const char* ficheiro, int* totV, int* totA, Arena* arena, bool* res);
+
+/**
+ * @brief Funo chamada por ScanMatrixText para cada linha no vazia da matriz.
+ *
+ * Recebe o contexto do chamador, o ndice da linha (a contar de 0 entre as linhas no vazias),
+ * os valores da linha e o seu nmero. Retorna false para interromper a leitura.
+ */
+typedef bool (*LinhaMatriz)(void* contexto, int linha, const int* valores, int numValores);
+
+struct Graph;
+struct Graph* readFileGraph(const char* ficheiro, int* totV, int* totA, bool* res);
+bool ScanMatrixText(const char* inicio, const char* fim, LinhaMatriz f, void* contexto, int* linhas, int* colunas);
+struct Graph* readFileGraphMap(const char* ficheiro, int* totV, int* totA, bool* res);
+
+struct CSR;
+struct Graph* readFileGraphParallel(const char* ficheiro, int numThreads, int* totV, int* totA, bool* res);
+struct CSR* readFileCSRParallel(const char* ficheiro, int numThreads, int* totV, int* totA, bool* res);
+
+struct EdgeBuffer;
+bool ReadEdgeList(const char* ficheiro, struct EdgeBuffer* b, int* numVertices);
+struct Graph* readFileEdgesGraph(const char* ficheiro, int* totV, int* totA, bool* res);
+struct CSR* readFileEdgesCSR(const char* ficheiro, int* totV, int* totA, bool* res);
 
 #endif /* IN */
@@ -0,0 +1,155 @@
+/**
+ * @file   MapFile.c
+ * @author Hugo Lopes_30516
+ *
+ * @brief Implementao do mapeamento de ficheiros em memria (Windows e POSIX).
+ *
+ * @date   Outubro 2026
+ */
+
+#ifndef _WIN32
+// posix_madvise s  declarado em <sys/mman.h> com as extenses POSIX ativas (ex.: -std=c11)
+#ifndef _POSIX_C_SOURCE
+#define _POSIX_C_SOURCE 200112L
+#endif
+#endif
+
+#include <stdlib.h>
+#include <stdbool.h>
+#include "MapFile.h"
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+
+#pragma region Mapeia um ficheiro em memria.
+/**
+ * @brief Abre um ficheiro e mapeia todo o seu contedo em memria, s para leitura.
+ *
+ * @param m Apontador para a estrutura a preencher.
+ * @param ficheiro O nome do ficheiro.
+ * @return true se o ficheiro foi mapeado (um ficheiro vazio fica com dados = NULL e tamanho = 0);
+ *         false se no foi possvel abrir ou mapear o ficheiro.
+ */
+bool OpenMapFile(MapFile* m, const char* ficheiro)
+{
+    if (m == NULL || ficheiro == NULL) return false;
+    m->dados = NULL;
+    m->tamanho = 0;
+
+#ifdef _WIN32
+    m->mapa = NULL;
+    m->ficheiro = CreateFileA(ficheiro, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING,
+        FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+    if (m->ficheiro == INVALID_HANDLE_VALUE)
+    {
+        m->ficheiro = NULL;
+        return false;
+    }
+
+    LARGE_INTEGER tam;
+    if (!GetFileSizeEx((HANDLE)m->ficheiro, &tam))
+    {
+        CloseHandle((HANDLE)m->ficheiro);
+        m->ficheiro = NULL;
+        return false;
+    }
+    m->tamanho = (size_t)tam.QuadPart;
+    if (m->tamanho == 0) return true; // No  possvel mapear um ficheiro vazio
+
+    m->mapa = CreateFileMappingA((HANDLE)m->ficheiro, NULL, PAGE_READONLY, 0, 0, NULL);
+    if (m->mapa != NULL) m->dados = (const char*)MapViewOfFile((HANDLE)m->mapa, FILE_MAP_READ, 0, 0, 0);
+    if (m->dados == NULL)
+    {
+        CloseMapFile(m);
+        return false;
+    }
+#else
+    m->fd = open(ficheiro, O_RDONLY);
+    if (m->fd < 0) return false;
+
+    struct stat info;
+    if (fstat(m->fd, &info) != 0)
+    {
+        close(m->fd);
+        m->fd = -1;
+        return false;
+    }
+    m->tamanho = (size_t)info.st_size;
+    if (m->tamanho == 0) return true; // No  possvel mapear um ficheiro vazio
+
+    void* p = mmap(NULL, m->tamanho, PROT_READ, MAP_SHARED, m->fd, 0);
+    if (p == MAP_FAILED)
+    {
+        close(m->fd);
+        m->fd = -1;
+        m->tamanho = 0;
+        return false;
+    }
+    m->dados = (const char*)p;
+
+    // O ficheiro  lido do incio ao fim
+    posix_madvise(p, m->tamanho, POSIX_MADV_SEQUENTIAL);
+#endif
+
+    return true;
+}
+#pragma endregion
+
+
+#pragma region Desfaz o mapeamento de um ficheiro.
+/**
+ * @brief Desfaz o mapeamento e fecha o ficheiro.
+ *
+ * @param m Apontador para o ficheiro mapeado.
+ */
+void CloseMapFile(MapFile* m)
+{
+    if (m == NULL) return;
+
+#ifdef _WIN32
+    if (m->dados != NULL) UnmapViewOfFile(m->dados);
+    if (m->mapa != NULL) CloseHandle((HANDLE)m->mapa);
+    if (m->ficheiro != NULL) CloseHandle((HANDLE)m->ficheiro);
+    m->mapa = NULL;
+    m->ficheiro = NULL;
+#else
+    if (m->dados != NULL) munmap((void*)m->dados, m->tamanho);
+    if (m->fd >= 0) close(m->fd);
+    m->fd = -1;
+#endif
+
+    m->dados = NULL;
+    m->tamanho = 0;
+}
+#pragma endregion
+
+
+#pragma region Indica ao sistema operativo como o ficheiro mapeado vai ser lido.
+/**
+ * @brief Indica ao sistema operativo o padro de acesso ao ficheiro mapeado.
+ *
+ * OpenMapFile assume uma leitura sequencial (leitura antecipada agressiva e pginas
+ * libertadas logo a seguir); estruturas consultadas em posies arbitrrias, como uma
+ * estrutura CSR mapeada, devem pedir o acesso aleatrio.
+ *
+ * @param m O ficheiro mapeado.
+ * @param sequencial true para leitura do incio ao fim; false para acesso aleatrio.
+ */
+void AdviseMapFile(MapFile* m, bool sequencial)
+{
+    if (m == NULL || m->dados == NULL) return;
+
+#ifdef _WIN32
+    (void)sequencial; // O padro de acesso  indicado ao abrir o ficheiro
+#else
+    posix_madvise((void*)m->dados, m->tamanho, sequencial ? POSIX_MADV_SEQUENTIAL : POSIX_MADV_RANDOM);
+#endif
+}
+#pragma endregion
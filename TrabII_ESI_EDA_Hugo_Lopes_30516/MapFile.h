@@ -0,0 +1,42 @@
+/**
+ * @file   MapFile.h
+ * @brief  Definies para mapear um ficheiro em memria (mmap / MapViewOfFile).
+ *
+ * O contedo do ficheiro fica acessvel como um vetor de bytes s de leitura,
+ * sem cpias para buffers intermdios; as pginas so carregadas pelo sistema operativo
+ *  medida que so acedidas e partilhadas entre processos que mapeiem o mesmo ficheiro.
+ *
+ * @date   Outubro 2026
+ * @author Hugo Lopes_30516
+ */
+
+#pragma once
+
+#define _CRT_SECURE_NO_WARNINGS
+
+#ifndef MAPFILE_H
+#define MAPFILE_H
+
+#include <stddef.h>
+#include <stdbool.h>
+
+ /**
+  * @brief Estrutura para representar um ficheiro mapeado em memria.
+  */
+typedef struct MapFile
+{
+    const char* dados;  /* Incio do contedo (NULL se o ficheiro estiver vazio) */
+    size_t tamanho;     /* Tamanho do ficheiro em bytes */
+#ifdef _WIN32
+    void* ficheiro;     /* HANDLE do ficheiro */
+    void* mapa;         /* HANDLE do mapeamento */
+#else
+    int fd;             /* Descritor do ficheiro */
+#endif
+} MapFile;
+
+bool OpenMapFile(MapFile* m, const char* ficheiro);
+void CloseMapFile(MapFile* m);
+void AdviseMapFile(MapFile* m, bool sequencial);
+
+#endif /* MAPFILE_H */
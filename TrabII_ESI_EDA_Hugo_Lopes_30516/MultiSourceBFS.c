@@ -0,0 +1,324 @@
+/**
+ * @file   MultiSourceBFS.c
+ * @author Hugo Lopes_30516
+ *
+ * @brief Implementao das consultas de alcanabilidade em lote (procura em largura com vrias origens).
+ *
+ * @date   Outubro 2026
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <malloc.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include "Graph.h"
+#include "CSR.h"
+#include "Threads.h"
+#include "MultiSourceBFS.h"
+
+ /**
+  * @brief Consulta de um lote, com os vrtices j convertidos em ndices da estrutura CSR.
+  */
+typedef struct
+{
+    int s;          /* ndice da origem */
+    int d;          /* ndice do destino */
+    int pos;        /* Posio da consulta no pedido (e em alcancaveis) */
+    int via;        /* Bit da origem na procura do lote */
+} ConsultaMSBFS;
+
+ /**
+  * @brief Argumento de cada thread: responde aos lotes id, id + numThreads, id + 2 * numThreads, ...
+  */
+typedef struct
+{
+    CSR* c;                         /* Estrutura CSR */
+    ConsultaMSBFS* consultas;       /* Consultas ordenadas por origem */
+    const int* lotes;               /* Incio de cada lote em consultas (numLotes + 1 posies) */
+    int numLotes;                   /* Nmero de lotes */
+    int numThreads;                 /* Nmero de threads */
+    int id;                         /* Nmero desta thread */
+    bool* alcancaveis;              /* Respostas, pela ordem do pedido */
+    bool ok;                        /* false se faltou memria */
+} TrabalhadorMSBFS;
+
+
+#pragma region Compara consultas pela origem.
+/**
+ * @brief Ordena as consultas pela origem (e pela posio no pedido, para uma ordem estvel).
+ */
+static int ComparaConsultasMSBFS(const void* a, const void* b)
+{
+    const ConsultaMSBFS* x = (const ConsultaMSBFS*)a;
+    const ConsultaMSBFS* y = (const ConsultaMSBFS*)b;
+    if (x->s != y->s) return (x->s < y->s) ? -1 : 1;
+    return (x->pos < y->pos) ? -1 : (x->pos > y->pos);
+}
+#pragma endregion
+
+
+#pragma region Responde s consultas de um lote.
+/**
+ * @brief Procura em largura com as origens de consultas[inicio..fim) em simultneo.
+ *
+ * vias tem 2 * numVertices * MSBFS_PALAVRAS palavras e visitar numVertices * MSBFS_PALAVRAS;
+ * cada vrtice usa W palavras, com W o nmero de palavras necessrias s vias do lote.
+ * Em vias, as W palavras das vias j vistas num vrtice so seguidas das W palavras das
+ * vias que l chegam no nvel atual, para que a passagem por uma adjacncia leia uma nica
+ * linha de cache. visitar tem de estar a zero e fica a zero no fim. A cada nvel, as consultas
+ * cujo destino j foi alcanado pela sua via ficam respondidas, e as vias sem consultas por
+ * responder deixam de ser propagadas.
+ */
+static void RespondeLoteMSBFS(CSR* c, ConsultaMSBFS* consultas, int inicio, int fim, bool* alcancaveis,
+    uint64_t* vias, uint64_t* visitar, int* atual, int* seguinte)
+{
+    int n = c->numVertices;
+    int numVias = consultas[fim - 1].via + 1;
+    int W = (numVias + 63) / 64;
+    int pendentes[MSBFS_LARGURA];
+    uint64_t ativas[MSBFS_PALAVRAS];
+
+    memset(vias, 0, (size_t)n * 2 * W * sizeof(uint64_t));
+    memset(pendentes, 0, sizeof(pendentes));
+    memset(ativas, 0, sizeof(ativas));
+
+    // Cada via comea na sua origem
+    int tamAtual = 0;
+    for (int q = inicio; q < fim; q++)
+    {
+        int v = consultas[q].via;
+        uint64_t bit = (uint64_t)1 << (v % 64);
+        pendentes[v]++;
+        ativas[v / 64] |= bit;
+
+        size_t p = (size_t)consultas[q].s * W;
+        if (vias[2 * p + v / 64] & bit) continue;
+
+        bool vazio = true;
+        for (int k = 0; k < W; k++) if (visitar[p + k] != 0) vazio = false;
+        if (vazio) atual[tamAtual++] = consultas[q].s;
+        vias[2 * p + v / 64] |= bit;
+        visitar[p + v / 64] |= bit;
+    }
+
+    int porResponder = fim - inicio;
+    while (true)
+    {
+        // Responde s consultas cujo destino j foi alcanado pela sua via
+        for (int q = inicio; q < fim; q++)
+        {
+            int v = consultas[q].via;
+            if (alcancaveis[consultas[q].pos]) continue;
+            if (!((vias[(size_t)consultas[q].d * 2 * W + v / 64] >> (v % 64)) & 1)) continue;
+
+            alcancaveis[consultas[q].pos] = true;
+            porResponder--;
+            if (--pendentes[v] == 0) ativas[v / 64] &= ~((uint64_t)1 << (v % 64));
+        }
+        if (porResponder == 0 || tamAtual == 0) break;
+
+        // Expande um nvel: as vias de u passam para cada adjacente que ainda no as viu
+        int tamSeguinte = 0;
+        for (int i = 0; i < tamAtual; i++)
+        {
+            int u = atual[i];
+            uint64_t propagar[MSBFS_PALAVRAS];
+            uint64_t algumas = 0;
+            for (int k = 0; k < W; k++)
+            {
+                propagar[k] = visitar[(size_t)u * W + k] & ativas[k];
+                visitar[(size_t)u * W + k] = 0;
+                algumas |= propagar[k];
+            }
+            if (algumas == 0) continue;
+
+            for (int e = c->offsets[u]; e < c->offsets[u + 1]; e++)
+            {
+                uint64_t* vistas = vias + (size_t)c->destinos[e] * 2 * W;
+                uint64_t* chegadas = vistas + W;
+                uint64_t antes = 0, novas = 0;
+                for (int k = 0; k < W; k++)
+                {
+                    uint64_t x = propagar[k] & ~vistas[k];
+                    antes |= chegadas[k];
+                    chegadas[k] |= x;
+                    novas |= x;
+                }
+                if (novas != 0 && antes == 0) seguinte[tamSeguinte++] = c->destinos[e];
+            }
+        }
+
+        // Os vrtices alcanados passam a vistos e formam a nova fronteira
+        for (int i = 0; i < tamSeguinte; i++)
+        {
+            uint64_t* vistas = vias + (size_t)seguinte[i] * 2 * W;
+            uint64_t* chegadas = vistas + W;
+            for (int k = 0; k < W; k++)
+            {
+                vistas[k] |= chegadas[k];
+                visitar[(size_t)seguinte[i] * W + k] = chegadas[k];
+                chegadas[k] = 0;
+            }
+        }
+
+        int* troca = atual;
+        atual = seguinte;
+        seguinte = troca;
+        tamAtual = tamSeguinte;
+    }
+
+    // Deixa visitar a zero para o lote seguinte
+    for (int i = 0; i < tamAtual; i++)
+        for (int k = 0; k < W; k++) visitar[(size_t)atual[i] * W + k] = 0;
+}
+#pragma endregion
+
+
+#pragma region Tarefa de cada thread das consultas em lote.
+/**
+ * @brief Reserva os vetores da thread e responde aos seus lotes.
+ */
+static void TrabalhaMSBFS(void* argumento)
+{
+    TrabalhadorMSBFS* w = (TrabalhadorMSBFS*)argumento;
+    size_t palavras = (size_t)w->c->numVertices * MSBFS_PALAVRAS;
+
+    uint64_t* vias = (uint64_t*)calloc(2 * palavras, sizeof(uint64_t));
+    uint64_t* visitar = (uint64_t*)calloc(palavras, sizeof(uint64_t));
+    int* atual = (int*)malloc(w->c->numVertices * sizeof(int));
+    int* seguinte = (int*)malloc(w->c->numVertices * sizeof(int));
+    w->ok = vias != NULL && visitar != NULL && atual != NULL && seguinte != NULL;
+
+    for (int l = w->id; w->ok && l < w->numLotes; l += w->numThreads)
+        RespondeLoteMSBFS(w->c, w->consultas, w->lotes[l], w->lotes[l + 1], w->alcancaveis,
+            vias, visitar, atual, seguinte);
+
+    free(vias);
+    free(visitar);
+    free(atual);
+    free(seguinte);
+}
+#pragma endregion
+
+
+#pragma region ALGORITMOS
+
+/**
+ * @brief Responde a um lote de consultas "existe caminho da origem i para o destino i" numa estrutura CSR.
+ *
+ * As consultas so ordenadas pela origem e divididas em lotes com at MSBFS_LARGURA origens
+ * distintas; as consultas com a mesma origem partilham a mesma via. Cada lote  respondido
+ * por uma nica procura em largura (RespondeLoteMSBFS), e os lotes so distribudos por
+ * numThreads threads. Uma consulta com um vrtice inexistente tem resposta false.
+ *
+ * @param c A estrutura CSR.
+ * @param origens Os IDs dos vrtices de origem das consultas.
+ * @param destinos Os IDs dos vrtices de destino das consultas.
+ * @param numPares O nmero de consultas.
+ * @param alcancaveis Vetor (numPares posies) que recebe a resposta de cada consulta.
+ * @param numThreads O nmero de threads (<= 0 para um por processador).
+ * @return true se as consultas foram respondidas; false se os parmetros forem invlidos ou faltar memria.
+ */
+bool ReachableBatchCSR(CSR* c, const int* origens, const int* destinos, int numPares, bool* alcancaveis, int numThreads)
+{
+    if (c == NULL || numPares < 0 || (numPares > 0 && (origens == NULL || destinos == NULL || alcancaveis == NULL))) return false;
+
+    for (int i = 0; i < numPares; i++) alcancaveis[i] = false;
+
+    ConsultaMSBFS* consultas = (ConsultaMSBFS*)malloc((numPares > 0 ? numPares : 1) * sizeof(ConsultaMSBFS));
+    int* lotes = (int*)malloc((numPares + 1) * sizeof(int));
+    if (consultas == NULL || lotes == NULL)
+    {
+        free(consultas);
+        free(lotes);
+        return false;
+    }
+
+    // Converte os IDs em ndices (as consultas com vrtices inexistentes ficam com false)
+    int numConsultas = 0;
+    for (int i = 0; i < numPares; i++)
+    {
+        int s = IndexCSR(c, origens[i]);
+        int d = IndexCSR(c, destinos[i]);
+        if (s < 0 || d < 0) continue;
+        consultas[numConsultas].s = s;
+        consultas[numConsultas].d = d;
+        consultas[numConsultas].pos = i;
+        numConsultas++;
+    }
+    qsort(consultas, numConsultas, sizeof(ConsultaMSBFS), ComparaConsultasMSBFS);
+
+    // Divide em lotes de at MSBFS_LARGURA origens distintas e atribui as vias
+    int numLotes = 0;
+    int via = -1;
+    for (int q = 0; q < numConsultas; q++)
+    {
+        if (q == 0 || consultas[q].s != consultas[q - 1].s)
+        {
+            if (++via == MSBFS_LARGURA || q == 0)
+            {
+                lotes[numLotes++] = q;
+                via = 0;
+            }
+        }
+        consultas[q].via = via;
+    }
+    lotes[numLotes] = numConsultas;
+
+    int T = ThreadCount(numThreads);
+    if (T > numLotes) T = (numLotes > 0) ? numLotes : 1;
+
+    TrabalhadorMSBFS trabalhadores[MAX_THREADS];
+    for (int k = 0; k < T; k++)
+    {
+        trabalhadores[k].c = c;
+        trabalhadores[k].consultas = consultas;
+        trabalhadores[k].lotes = lotes;
+        trabalhadores[k].numLotes = numLotes;
+        trabalhadores[k].numThreads = T;
+        trabalhadores[k].id = k;
+        trabalhadores[k].alcancaveis = alcancaveis;
+        trabalhadores[k].ok = true;
+    }
+
+    bool ok = true;
+    if (numLotes > 0)
+    {
+        RunThreads(T, TrabalhaMSBFS, trabalhadores, sizeof(TrabalhadorMSBFS));
+        for (int k = 0; k < T; k++)
+            if (!trabalhadores[k].ok) ok = false;
+    }
+
+    free(consultas);
+    free(lotes);
+    return ok;
+}
+
+
+/**
+ * @brief Responde a um lote de consultas de alcanabilidade no grafo.
+ *
+ * Congela o grafo (FreezeGraph) e usa ReachableBatchCSR. Substitui uma chamada de
+ * DepthFirstSearchRec por consulta, sem alterar o estado "visitado" dos vrtices.
+ *
+ * @param g O apontador para o grafo.
+ * @param origens Os IDs dos vrtices de origem das consultas.
+ * @param destinos Os IDs dos vrtices de destino das consultas.
+ * @param numPares O nmero de consultas.
+ * @param alcancaveis Vetor (numPares posies) que recebe a resposta de cada consulta.
+ * @param numThreads O nmero de threads (<= 0 para um por processador).
+ * @return true se as consultas foram respondidas; false em caso de erro.
+ */
+bool ReachableBatch(Graph* g, const int* origens, const int* destinos, int numPares, bool* alcancaveis, int numThreads)
+{
+    bool ok;
+    CSR* c = FreezeGraph(g, &ok);
+    if (!ok) return false;
+
+    bool resultado = ReachableBatchCSR(c, origens, destinos, numPares, alcancaveis, numThreads);
+    DestroyCSR(c, &ok);
+    return resultado;
+}
+
+#pragma endregion
@@ -0,0 +1,34 @@
+/**
+ * @file   MultiSourceBFS.h
+ * @brief  Definies das consultas de alcanabilidade em lote (procura em largura com vrias origens).
+ *
+ * As consultas de um lote com origens diferentes so respondidas por uma nica procura em
+ * largura: cada origem ocupa um bit (uma "via") das palavras de 64 bits de cada vrtice, e a
+ * passagem por uma adjacncia propaga de uma s vez todas as vias que chegaram ao vrtice.
+ * At 64 * MSBFS_PALAVRAS origens partilham assim cada leitura das adjacncias.
+ *
+ * @date   Outubro 2026
+ * @author Hugo Lopes_30516
+ */
+
+#pragma once
+
+#define _CRT_SECURE_NO_WARNINGS
+
+#ifndef MULTISOURCEBFS_H
+#define MULTISOURCEBFS_H
+
+#include <stdbool.h>
+#include "Graph.h"
+#include "CSR.h"
+
+/* Palavras de 64 bits por vrtice: cada procura tem at 64 * MSBFS_PALAVRAS origens */
+#define MSBFS_PALAVRAS 4
+
+/* Nmero mximo de origens por procura */
+#define MSBFS_LARGURA (64 * MSBFS_PALAVRAS)
+
+bool ReachableBatchCSR(CSR* c, const int* origens, const int* destinos, int numPares, bool* alcancaveis, int numThreads);
+bool ReachableBatch(Graph* g, const int* origens, const int* destinos, int numPares, bool* alcancaveis, int numThreads);
+
+#endif /* MULTISOURCEBFS_H */
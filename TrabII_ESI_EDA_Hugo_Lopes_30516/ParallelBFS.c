@@ -0,0 +1,381 @@
+/**
+ * @file   ParallelBFS.c
+ * @author Hugo Lopes_30516
+ *
+ * @brief Implementao da procura em largura paralela com mudana de direo.
+ *
+ * @date   Outubro 2026
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <malloc.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include "Graph.h"
+#include "CSR.h"
+#include "Threads.h"
+#include "ParallelBFS.h"
+
+ /**
+  * @brief Argumento de cada thread na expanso de um nvel.
+  *
+  * Os vrtices descobertos ficam na lista prpria da thread (novos), que  mantida
+  * entre nveis; no fim do nvel as listas so juntadas na nova fronteira.
+  */
+typedef struct
+{
+    CSR* c;                     /* Estrutura CSR */
+    CSR* t;                     /* Estrutura CSR transposta (adjacncias de entrada) */
+    ParallelBFS* pb;            /* Resultados */
+    uint64_t* visitados;        /* Vetor de bits dos vrtices j alcanados */
+    const uint64_t* fronteira;  /* Vetor de bits da fronteira (s no passo bottom-up) */
+    const int* fila;            /* Fronteira atual */
+    int inicio;                 /* Parte desta thread: fila[inicio..fim) em top-down, vrtices [inicio..fim) em bottom-up */
+    int fim;
+    int nivel;                  /* Distncia dos vrtices da fronteira */
+    bool bottomUp;              /* Direo do passo */
+    int* novos;                 /* Vrtices descobertos por esta thread */
+    int numNovos;
+    int capNovos;
+    long long arestasNovos;     /* Soma das adjacncias de sada dos vrtices descobertos */
+    bool ok;                    /* false se faltou memria */
+} TrabalhadorBFS;
+
+
+#pragma region Cria uma estrutura para os resultados da procura em largura paralela.
+/**
+ * @brief Cria uma estrutura para os resultados de BreadthFirstParallelCSR e BreadthFirstParallel.
+ *
+ * @param capacidade Nmero de vrtices esperado (os vetores crescem na procura, se necessrio).
+ * @param res Apontador para um booleano que indica se a operao foi bem-sucedida.
+ * @return Um apontador para a estrutura criada, ou NULL se faltar memria.
+ */
+ParallelBFS* CreateParallelBFS(int capacidade, bool* res)
+{
+    *res = false;
+
+    ParallelBFS* pb = (ParallelBFS*)calloc(1, sizeof(ParallelBFS));
+    if (pb == NULL) return NULL;
+    if (capacidade < 16) capacidade = 16;
+
+    pb->ids = (int*)malloc(capacidade * sizeof(int));
+    pb->distancia = (int*)malloc(capacidade * sizeof(int));
+    pb->anteriores = (int*)malloc(capacidade * sizeof(int));
+    if (pb->ids == NULL || pb->distancia == NULL || pb->anteriores == NULL)
+    {
+        DestroyParallelBFS(pb, res);
+        *res = false;
+        return NULL;
+    }
+
+    pb->capacidade = capacidade;
+    pb->origem = -1;
+    *res = true;
+    return pb;
+}
+#pragma endregion
+
+
+#pragma region Liberta a memria de uma estrutura da procura em largura paralela.
+/**
+ * @brief Liberta a memria de uma estrutura de resultados da procura em largura paralela.
+ *
+ * @param pb A estrutura a libertar.
+ * @param res Apontador para um booleano que indica se a operao foi bem-sucedida.
+ * @return NULL (no h mais estrutura para apontar).
+ */
+ParallelBFS* DestroyParallelBFS(ParallelBFS* pb, bool* res)
+{
+    if (pb == NULL)
+    {
+        *res = false;
+        return NULL;
+    }
+
+    free(pb->ids);
+    free(pb->distancia);
+    free(pb->anteriores);
+    free(pb);
+
+    *res = true;
+    return NULL;
+}
+#pragma endregion
+
+
+#pragma region Acrescenta um vrtice  lista de uma thread.
+/**
+ * @brief Acrescenta o vrtice v aos descobertos da thread, aumentando a lista se necessrio.
+ */
+static bool AcrescentaNovoBFS(TrabalhadorBFS* w, int v)
+{
+    if (w->numNovos == w->capNovos)
+    {
+        int novaCap = (w->capNovos > 0) ? w->capNovos * 2 : 1024;
+        int* novo = (int*)realloc(w->novos, novaCap * sizeof(int));
+        if (novo == NULL) return false;
+        w->novos = novo;
+        w->capNovos = novaCap;
+    }
+    w->novos[w->numNovos++] = v;
+    w->arestasNovos += w->c->offsets[v + 1] - w->c->offsets[v];
+    return true;
+}
+#pragma endregion
+
+
+#pragma region Expande a parte de um nvel atribuda a uma thread.
+/**
+ * @brief Expande um nvel: top-down sobre fila[inicio..fim) ou bottom-up sobre os vrtices [inicio..fim).
+ *
+ * Em top-down, vrios vrtices da fronteira podem alcanar o mesmo vrtice: s a thread que
+ * liga o seu bit em visitados (TestAndSetBitThread) escreve a distncia e o antecessor.
+ * Em bottom-up, as partes das threads comeam em mltiplos de 64, pelo que cada palavra de
+ * visitados s  escrita por uma thread e basta uma escrita simples.
+ */
+static void ExpandeNivelBFS(void* argumento)
+{
+    TrabalhadorBFS* w = (TrabalhadorBFS*)argumento;
+    int* distancia = w->pb->distancia;
+    int* anteriores = w->pb->anteriores;
+    w->numNovos = 0;
+    w->arestasNovos = 0;
+
+    if (!w->bottomUp)
+    {
+        for (int q = w->inicio; q < w->fim && w->ok; q++)
+        {
+            int u = w->fila[q];
+            for (int e = w->c->offsets[u]; e < w->c->offsets[u + 1]; e++)
+            {
+                int v = w->c->destinos[e];
+                if (!TestAndSetBitThread(w->visitados, v)) continue;
+
+                distancia[v] = w->nivel + 1;
+                anteriores[v] = u;
+                if (!AcrescentaNovoBFS(w, v))
+                {
+                    w->ok = false;
+                    break;
+                }
+            }
+        }
+        return;
+    }
+
+    for (int v = w->inicio; v < w->fim && w->ok; v++)
+    {
+        if ((w->visitados[v / 64] >> (v % 64)) & 1) continue;
+
+        // Procura um antecessor na fronteira entre as adjacncias de entrada
+        for (int e = w->t->offsets[v]; e < w->t->offsets[v + 1]; e++)
+        {
+            int u = w->t->destinos[e];
+            if (!((w->fronteira[u / 64] >> (u % 64)) & 1)) continue;
+
+            w->visitados[v / 64] |= (uint64_t)1 << (v % 64);
+            distancia[v] = w->nivel + 1;
+            anteriores[v] = u;
+            if (!AcrescentaNovoBFS(w, v)) w->ok = false;
+            break;
+        }
+    }
+}
+#pragma endregion
+
+
+#pragma region ALGORITMOS
+
+/**
+ * @brief Procura em largura paralela, com mudana de direo, a partir de um vrtice de uma estrutura CSR.
+ *
+ * Em cada nvel escolhe a direo: passa a bottom-up quando as adjacncias de sada da
+ * fronteira excedem 1/BFS_ALFA das adjacncias dos vrtices por visitar, e volta a top-down
+ * quando a fronteira tem menos de 1/BFS_BETA dos vrtices. Nos grafos de pequeno dimetro,
+ * os nveis centrais (quase todos os vrtices) so assim expandidos sem percorrer as
+ * adjacncias de sada de toda a fronteira. As distncias so as mesmas de uma procura em
+ * largura sequencial; o antecessor de cada vrtice  um vrtice do nvel anterior, que
+ * pode variar de execuo para execuo.
+ *
+ * @param c A estrutura CSR.
+ * @param t A estrutura CSR transposta de c (ver TransposeCSR).
+ * @param origem O ID do vrtice de origem.
+ * @param numThreads O nmero de threads (<= 0 para um por processador).
+ * @param pb A estrutura onde so guardados os resultados (criada com CreateParallelBFS e reutilizvel).
+ * @return true se a procura foi feita; false se o vrtice no existir ou faltar memria.
+ */
+bool BreadthFirstParallelCSR(CSR* c, CSR* t, int origem, int numThreads, ParallelBFS* pb)
+{
+    if (c == NULL || t == NULL || pb == NULL || t->numVertices != c->numVertices) return false;
+
+    int s = IndexCSR(c, origem);
+    if (s < 0) return false;
+
+    int n = c->numVertices;
+    if (n > pb->capacidade)
+    {
+        int novaCap = pb->capacidade * 2;
+        if (novaCap < n) novaCap = n;
+
+        int** vetores[3] = { &pb->ids, &pb->distancia, &pb->anteriores };
+        for (int i = 0; i < 3; i++)
+        {
+            int* novo = (int*)realloc(*vetores[i], novaCap * sizeof(int));
+            if (novo == NULL) return false;
+            *vetores[i] = novo;
+        }
+        pb->capacidade = novaCap;
+    }
+
+    int palavras = (n + 63) / 64;
+    uint64_t* visitados = (uint64_t*)calloc(palavras, sizeof(uint64_t));
+    uint64_t* fronteira = (uint64_t*)malloc(palavras * sizeof(uint64_t));
+    int* fila = (int*)malloc(n * sizeof(int));
+    if (visitados == NULL || fronteira == NULL || fila == NULL)
+    {
+        free(visitados);
+        free(fronteira);
+        free(fila);
+        return false;
+    }
+
+    memcpy(pb->ids, c->ids, n * sizeof(int));
+    for (int i = 0; i < n; i++)
+    {
+        pb->distancia[i] = BFS_INALCANCADO;
+        pb->anteriores[i] = -1;
+    }
+    pb->n = n;
+    pb->origem = s;
+    pb->niveis = pb->niveisBottomUp = 0;
+    pb->distancia[s] = 0;
+    visitados[s / 64] |= (uint64_t)1 << (s % 64);
+
+    int T = ThreadCount(numThreads);
+    TrabalhadorBFS trabalhadores[MAX_THREADS];
+    memset(trabalhadores, 0, T * sizeof(TrabalhadorBFS));
+
+    fila[0] = s;
+    int tamFila = 1;
+    long long arestasFronteira = c->offsets[s + 1] - c->offsets[s];
+    long long arestasPorExplorar = c->numArestas - arestasFronteira;
+    bool bottomUp = false;
+    bool ok = true;
+
+    while (tamFila > 0 && ok)
+    {
+        // Escolhe a direo do passo
+        if (!bottomUp && arestasFronteira * BFS_ALFA > arestasPorExplorar) bottomUp = true;
+        else if (bottomUp && (long long)tamFila * BFS_BETA < n) bottomUp = false;
+
+        if (bottomUp)
+        {
+            memset(fronteira, 0, palavras * sizeof(uint64_t));
+            for (int q = 0; q < tamFila; q++) fronteira[fila[q] / 64] |= (uint64_t)1 << (fila[q] % 64);
+        }
+
+        for (int k = 0; k < T; k++)
+        {
+            TrabalhadorBFS* w = &trabalhadores[k];
+            w->c = c;
+            w->t = t;
+            w->pb = pb;
+            w->visitados = visitados;
+            w->fronteira = fronteira;
+            w->fila = fila;
+            w->nivel = pb->niveis;
+            w->bottomUp = bottomUp;
+            w->ok = true;
+            if (bottomUp)
+            {
+                // Partes alinhadas a palavras de 64 vrtices
+                w->inicio = (int)((long long)palavras * k / T) * 64;
+                w->fim = (int)((long long)palavras * (k + 1) / T) * 64;
+                if (w->fim > n) w->fim = n;
+            }
+            else
+            {
+                w->inicio = (int)((long long)tamFila * k / T);
+                w->fim = (int)((long long)tamFila * (k + 1) / T);
+            }
+        }
+
+        RunThreads(T, ExpandeNivelBFS, trabalhadores, sizeof(TrabalhadorBFS));
+
+        // Junta os vrtices descobertos na nova fronteira
+        tamFila = 0;
+        arestasFronteira = 0;
+        for (int k = 0; k < T; k++)
+        {
+            if (!trabalhadores[k].ok) ok = false;
+            if (trabalhadores[k].numNovos > 0)
+                memcpy(fila + tamFila, trabalhadores[k].novos, trabalhadores[k].numNovos * sizeof(int));
+            tamFila += trabalhadores[k].numNovos;
+            arestasFronteira += trabalhadores[k].arestasNovos;
+        }
+        arestasPorExplorar -= arestasFronteira;
+
+        pb->niveis++;
+        if (bottomUp) pb->niveisBottomUp++;
+    }
+
+    for (int k = 0; k < T; k++) free(trabalhadores[k].novos);
+    free(visitados);
+    free(fronteira);
+    free(fila);
+    return ok;
+}
+
+
+/**
+ * @brief Procura em largura paralela, com mudana de direo, a partir de um vrtice do grafo.
+ *
+ * Congela o grafo (FreezeGraph), cria a estrutura transposta e usa BreadthFirstParallelCSR.
+ * Para vrias procuras no mesmo grafo,  prefervel criar as duas estruturas uma s vez.
+ *
+ * @param g O apontador para o grafo.
+ * @param origem O ID do vrtice de origem.
+ * @param numThreads O nmero de threads (<= 0 para um por processador).
+ * @param pb A estrutura onde so guardados os resultados.
+ * @return true se a procura foi feita; false se o vrtice no existir ou faltar memria.
+ */
+bool BreadthFirstParallel(Graph* g, int origem, int numThreads, ParallelBFS* pb)
+{
+    bool ok;
+    CSR* c = FreezeGraph(g, &ok);
+    if (!ok) return false;
+
+    CSR* t = TransposeCSR(c, &ok);
+    bool resultado = ok && BreadthFirstParallelCSR(c, t, origem, numThreads, pb);
+
+    if (t != NULL) DestroyCSR(t, &ok);
+    DestroyCSR(c, &ok);
+    return resultado;
+}
+
+
+/**
+ * @brief Reconstri o caminho com menos adjacncias desde a origem at um vrtice, na ltima procura.
+ *
+ * O caminho s  escrito se couber em max posies; caso contrrio, o valor devolvido
+ * indica o tamanho necessrio.
+ *
+ * @param pb A estrutura preenchida por BreadthFirstParallelCSR ou BreadthFirstParallel.
+ * @param k O ndice do vrtice final.
+ * @param caminho Vetor que recebe os IDs dos vrtices, da origem at ao vrtice final.
+ * @param max Nmero de posies de caminho.
+ * @return O nmero de vrtices do caminho, ou 0 se o vrtice no foi alcanado.
+ */
+int PathParallelBFS(ParallelBFS* pb, int k, int* caminho, int max)
+{
+    if (pb == NULL || k < 0 || k >= pb->n || pb->distancia[k] == BFS_INALCANCADO) return 0;
+
+    int tam = pb->distancia[k] + 1;
+    if (tam > max || caminho == NULL) return tam;
+
+    for (int i = tam - 1, j = k; i >= 0; i--, j = pb->anteriores[j]) caminho[i] = pb->ids[j];
+    return tam;
+}
+
+#pragma endregion
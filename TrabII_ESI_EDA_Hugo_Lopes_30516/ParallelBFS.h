@@ -0,0 +1,60 @@
+/**
+ * @file   ParallelBFS.h
+ * @brief  Definies da procura em largura paralela com mudana de direo (top-down / bottom-up).
+ *
+ * Cada nvel  expandido por vrias threads. Enquanto a fronteira  pequena, cada thread
+ * percorre as adjacncias de sada de uma parte da fronteira (top-down) e reclama os vrtices
+ * novos com uma operao atmica sobre o vetor de bits dos visitados. Quando a fronteira
+ * passa a ter muitas adjacncias, cada thread percorre uma parte dos vrtices por visitar e
+ * procura, nas adjacncias de entrada (estrutura CSR transposta), um vrtice da fronteira
+ * (bottom-up), parando no primeiro que encontra.
+ *
+ * @date   Outubro 2026
+ * @author Hugo Lopes_30516
+ */
+
+#pragma once
+
+#define _CRT_SECURE_NO_WARNINGS
+
+#ifndef PARALLELBFS_H
+#define PARALLELBFS_H
+
+#include <stdbool.h>
+#include "Graph.h"
+#include "CSR.h"
+
+/* Distncia de um vrtice inalcanvel a partir da origem */
+#define BFS_INALCANCADO -1
+
+/* Passa a bottom-up quando as adjacncias da fronteira excedem 1/BFS_ALFA das adjacncias por explorar */
+#define BFS_ALFA 14
+
+/* Volta a top-down quando a fronteira tem menos de 1/BFS_BETA dos vrtices */
+#define BFS_BETA 24
+
+ /**
+  * @brief Estrutura para guardar os resultados de uma procura em largura paralela.
+  *
+  * Os vetores so indexados pelo ndice dos vrtices na estrutura CSR e podem ser
+  * reutilizados em procuras sucessivas.
+  */
+typedef struct ParallelBFS
+{
+    int n;                  /* Nmero de vrtices da ltima procura */
+    int capacidade;         /* Nmero de posies reservadas em cada vetor */
+    int origem;             /* ndice do vrtice de origem */
+    int niveis;             /* Nmero de nveis expandidos */
+    int niveisBottomUp;     /* Quantos desses nveis foram expandidos bottom-up */
+    int* ids;               /* ID do vrtice de cada ndice */
+    int* distancia;         /* Nmero de adjacncias desde a origem (BFS_INALCANCADO se inalcanvel) */
+    int* anteriores;        /* ndice do antecessor na rvore da procura (-1 na origem e nos inalcanveis) */
+} ParallelBFS;
+
+ParallelBFS* CreateParallelBFS(int capacidade, bool* res);
+ParallelBFS* DestroyParallelBFS(ParallelBFS* pb, bool* res);
+bool BreadthFirstParallelCSR(CSR* c, CSR* t, int origem, int numThreads, ParallelBFS* pb);
+bool BreadthFirstParallel(Graph* g, int origem, int numThreads, ParallelBFS* pb);
+int PathParallelBFS(ParallelBFS* pb, int k, int* caminho, int max);
+
+#endif /* PARALLELBFS_H */
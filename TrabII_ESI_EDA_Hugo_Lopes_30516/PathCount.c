@@ -0,0 +1,615 @@
+/**
+ * @file   PathCount.c
+ * @author Hugo Lopes_30516
+ *
+ * @brief Implementao da contagem de caminhos simples com contadores de 128 bits.
+ *
+ * @date   Outubro 2026
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <malloc.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include "Graph.h"
+#include "CSR.h"
+#include "Threads.h"
+#include "PathCount.h"
+
+
+#pragma region Soma duas contagens.
+/**
+ * @brief Soma b a a (a = a + b), assinalando se o resultado no cabe em 128 bits.
+ *
+ * @param a A contagem que recebe a soma.
+ * @param b A contagem a somar.
+ */
+void AddContagem(Contagem* a, const Contagem* b)
+{
+    uint64_t baixo = a->baixo + b->baixo;
+    uint64_t transporte = (baixo < a->baixo) ? 1 : 0;
+    uint64_t alto = a->alto + b->alto;
+    bool transbordou = (alto < a->alto);
+    if (alto + transporte < alto) transbordou = true;
+
+    a->baixo = baixo;
+    a->alto = alto + transporte;
+    a->transbordou = a->transbordou || b->transbordou || transbordou;
+}
+#pragma endregion
+
+
+#pragma region Escreve uma contagem em decimal.
+/**
+ * @brief Escreve a contagem em decimal (ou "excede 128 bits" se transbordou).
+ *
+ * @param c A contagem.
+ * @param texto O texto a preencher.
+ * @param tam O tamanho de texto (CONTAGEM_TEXTO chega sempre).
+ */
+void ContagemToString(const Contagem* c, char* texto, size_t tam)
+{
+    if (texto == NULL || tam == 0) return;
+    if (c->transbordou)
+    {
+        snprintf(texto, tam, "excede 128 bits");
+        return;
+    }
+
+    // Divide sucessivamente por 10, em quatro partes de 32 bits (da mais significativa para a menos)
+    uint32_t partes[4] = { (uint32_t)(c->alto >> 32), (uint32_t)c->alto, (uint32_t)(c->baixo >> 32), (uint32_t)c->baixo };
+    char algarismos[CONTAGEM_TEXTO];
+    int n = 0;
+    do
+    {
+        uint64_t resto = 0;
+        for (int i = 0; i < 4; i++)
+        {
+            uint64_t atual = (resto << 32) | partes[i];
+            partes[i] = (uint32_t)(atual / 10);
+            resto = atual % 10;
+        }
+        algarismos[n++] = (char)('0' + resto);
+    } while (partes[0] | partes[1] | partes[2] | partes[3]);
+
+    // Os algarismos foram obtidos do menos para o mais significativo
+    size_t i = 0;
+    while (n > 0 && i + 1 < tam) texto[i++] = algarismos[--n];
+    texto[i] = '\0';
+}
+#pragma endregion
+
+
+#pragma region Marca os vrtices alcanados por uma procura em largura.
+/**
+ * @brief Procura em largura a partir de inicio, acrescentando o bit marca a estado[] dos vrtices alcanados.
+ */
+static void MarcaAlcancadosCount(CSR* c, int inicio, char marca, char* estado, int* fila)
+{
+    estado[inicio] |= marca;
+    fila[0] = inicio;
+    int frente = 0, fim = 1;
+    while (frente < fim)
+    {
+        int u = fila[frente++];
+        for (int e = c->offsets[u]; e < c->offsets[u + 1]; e++)
+        {
+            int w = c->destinos[e];
+            if (estado[w] & marca) continue;
+            estado[w] |= marca;
+            fila[fim++] = w;
+        }
+    }
+}
+#pragma endregion
+
+
+#pragma region Conta os caminhos a partir de um vrtice do caminho atual.
+/**
+ * @brief Conta os caminhos simples de u at d que no passam por vrtices marcados em visitados.
+ *
+ * u j tem de estar marcado e continua marcado no fim; os outros vrtices marcados durante
+ * a enumerao so desmarcados. S entra em vrtices relevantes (estado == 3), pelo que nunca
+ * segue ramos que no alcanam o destino. pilha e cursores tm de ter numVertices posies.
+ */
+static uint64_t ContaDesdeCount(CSR* c, int u, int d, const char* estado, uint64_t* visitados, int* pilha, int* cursores)
+{
+    uint64_t total = 0;
+    pilha[0] = u;
+    cursores[0] = c->offsets[u];
+    int topo = 1;
+
+    while (topo > 0)
+    {
+        int x = pilha[topo - 1];
+        if (cursores[topo - 1] == c->offsets[x + 1])
+        {
+            // Desmarca o vrtice para permitir outros caminhos (exceto o vrtice inicial)
+            if (--topo > 0) visitados[x / 64] &= ~((uint64_t)1 << (x % 64));
+            continue;
+        }
+
+        int w = c->destinos[cursores[topo - 1]++];
+        if (estado[w] != 3 || (visitados[w / 64] >> (w % 64)) & 1) continue; // Poda: w no alcana o destino
+        if (w == d)
+        {
+            total++;
+            continue;
+        }
+        visitados[w / 64] |= (uint64_t)1 << (w % 64);
+        pilha[topo] = w;
+        cursores[topo++] = c->offsets[w];
+    }
+    return total;
+}
+#pragma endregion
+
+
+/* Nmero de tarefas por thread que a diviso inicial da enumerao procura criar */
+#define TAREFAS_POR_THREAD 16
+
+/* Nmero mximo de vrtices do prefixo de uma tarefa */
+#define PROFUNDIDADE_TAREFAS 16
+
+ /**
+  * @brief Tarefas por fazer de uma thread: a dona retira do fim, as outras roubam do incio.
+  */
+typedef struct
+{
+    MutexThread* trinco;    /* Protege inicio e fim */
+    int inicio;             /* Primeira tarefa por fazer */
+    int fim;                /* Tarefa a seguir  ltima por fazer */
+} FilaTarefasCount;
+
+ /**
+  * @brief Argumento de cada thread da enumerao paralela.
+  *
+  * A tarefa t  o prefixo de caminho prefixos[inicios[t]] .. prefixos[inicios[t+1]-1],
+  * que comea na origem; a thread conta os caminhos que o continuam at ao destino.
+  */
+typedef struct
+{
+    CSR* c;                         /* Estrutura CSR */
+    int d;                          /* ndice do destino */
+    const char* estado;             /* Vrtices relevantes (estado == 3) */
+    const int* prefixos;            /* Vrtices dos prefixos de todas as tarefas */
+    const int* inicios;             /* Incio do prefixo de cada tarefa (numTarefas + 1 posies) */
+    FilaTarefasCount* filas;        /* Filas de tarefas de todas as threads */
+    int numThreads;                 /* Nmero de threads */
+    int id;                         /* Nmero desta thread */
+    uint64_t contagem;              /* Caminhos contados por esta thread */
+    bool ok;                        /* false se faltou memria */
+} TrabalhadorCount;
+
+
+#pragma region Obtm a prxima tarefa de uma thread.
+/**
+ * @brief Retira uma tarefa da fila da prpria thread ou, se estiver vazia, rouba uma a outra thread.
+ *
+ * @return O nmero da tarefa, ou -1 se j no houver tarefas por fazer.
+ */
+static int ProximaTarefaCount(TrabalhadorCount* w)
+{
+    for (int k = 0; k < w->numThreads; k++)
+    {
+        FilaTarefasCount* f = &w->filas[(w->id + k) % w->numThreads];
+        int tarefa = -1;
+
+        LockMutexThread(f->trinco);
+        if (f->inicio < f->fim) tarefa = (k == 0) ? --f->fim : f->inicio++;
+        UnlockMutexThread(f->trinco);
+
+        if (tarefa >= 0) return tarefa;
+    }
+    return -1;
+}
+#pragma endregion
+
+
+#pragma region Tarefa de cada thread da enumerao paralela.
+/**
+ * @brief Executa tarefas at no haver mais: marca o prefixo, conta as continuaes e desmarca-o.
+ */
+static void TrabalhaCount(void* argumento)
+{
+    TrabalhadorCount* w = (TrabalhadorCount*)argumento;
+    int n = w->c->numVertices;
+
+    // Estado prprio da thread: vetor de bits dos vrtices do caminho atual e pilha da enumerao
+    uint64_t* visitados = (uint64_t*)calloc((n + 63) / 64, sizeof(uint64_t));
+    int* pilha = (int*)malloc(n * sizeof(int));
+    int* cursores = (int*)malloc(n * sizeof(int));
+    w->ok = visitados != NULL && pilha != NULL && cursores != NULL;
+
+    int t;
+    while (w->ok && (t = ProximaTarefaCount(w)) >= 0)
+    {
+        for (int i = w->inicios[t]; i < w->inicios[t + 1]; i++)
+            visitados[w->prefixos[i] / 64] |= (uint64_t)1 << (w->prefixos[i] % 64);
+
+        int ultimo = w->prefixos[w->inicios[t + 1] - 1];
+        w->contagem += ContaDesdeCount(w->c, ultimo, w->d, w->estado, visitados, pilha, cursores);
+
+        for (int i = w->inicios[t]; i < w->inicios[t + 1]; i++)
+            visitados[w->prefixos[i] / 64] &= ~((uint64_t)1 << (w->prefixos[i] % 64));
+    }
+
+    free(visitados);
+    free(pilha);
+    free(cursores);
+}
+#pragma endregion
+
+
+#pragma region Divide a enumerao em tarefas.
+/**
+ * @brief Expande a rvore de procura a partir de s, nvel a nvel, at haver tarefas suficientes.
+ *
+ * Cada tarefa  um prefixo de caminho simples entre vrtices relevantes; os caminhos que chegam
+ * ao destino durante a expanso so somados a encontrados.
+ *
+ * @return true se a diviso foi feita; false se faltar memria (*prefixos e *inicios ficam a NULL).
+ */
+static bool DivideTarefasCount(CSR* c, int s, int d, const char* estado, int objetivo,
+    int** prefixos, int** inicios, int* numTarefas, uint64_t* encontrados)
+{
+    int* p = (int*)malloc(sizeof(int));
+    int* ini = (int*)malloc(2 * sizeof(int));
+    if (p == NULL || ini == NULL)
+    {
+        free(p);
+        free(ini);
+        *prefixos = *inicios = NULL;
+        return false;
+    }
+    p[0] = s;
+    ini[0] = 0;
+    ini[1] = 1;
+    int num = 1;
+
+    for (int prof = 1; num > 0 && num < objetivo && prof < PROFUNDIDADE_TAREFAS; prof++)
+    {
+        // Primeira passagem: conta os prefixos do nvel seguinte
+        int novos = 0;
+        for (int t = 0; t < num; t++)
+        {
+            int u = p[ini[t + 1] - 1];
+            for (int e = c->offsets[u]; e < c->offsets[u + 1]; e++)
+            {
+                int w = c->destinos[e];
+                if (estado[w] != 3 || w == d) continue;
+                bool noPrefixo = false;
+                for (int i = ini[t]; i < ini[t + 1] && !noPrefixo; i++) noPrefixo = (p[i] == w);
+                if (!noPrefixo) novos++;
+            }
+        }
+
+        int* np = (int*)malloc(((size_t)novos * (prof + 1) + 1) * sizeof(int));
+        int* nini = (int*)malloc(((size_t)novos + 1) * sizeof(int));
+        if (np == NULL || nini == NULL)
+        {
+            free(np);
+            free(nini);
+            free(p);
+            free(ini);
+            *prefixos = *inicios = NULL;
+            return false;
+        }
+
+        // Segunda passagem: copia os prefixos prolongados e conta os caminhos que terminam no destino
+        int k = 0, pos = 0;
+        nini[0] = 0;
+        for (int t = 0; t < num; t++)
+        {
+            int u = p[ini[t + 1] - 1];
+            for (int e = c->offsets[u]; e < c->offsets[u + 1]; e++)
+            {
+                int w = c->destinos[e];
+                if (estado[w] != 3) continue;
+                bool noPrefixo = false;
+                for (int i = ini[t]; i < ini[t + 1] && !noPrefixo; i++) noPrefixo = (p[i] == w);
+                if (noPrefixo) continue;
+                if (w == d)
+                {
+                    (*encontrados)++;
+                    continue;
+                }
+                for (int i = ini[t]; i < ini[t + 1]; i++) np[pos++] = p[i];
+                np[pos++] = w;
+                nini[++k] = pos;
+            }
+        }
+
+        free(p);
+        free(ini);
+        p = np;
+        ini = nini;
+        num = novos;
+    }
+
+    *prefixos = p;
+    *inicios = ini;
+    *numTarefas = num;
+    return true;
+}
+#pragma endregion
+
+
+#pragma region Conta caminhos por enumerao podada.
+/**
+ * @brief Enumera os caminhos simples de s at d, entrando apenas em vrtices relevantes (estado == 3).
+ *
+ * Com mais de uma thread, a rvore de procura  dividida em prefixos (DivideTarefasCount),
+ * distribudos pelas filas das threads; uma thread que esvazia a sua fila rouba tarefas
+ * s outras, pelo que ramos muito desiguais no deixam threads paradas.
+ *
+ * @param caminhos O nmero de caminhos encontrados.
+ * @return true se a contagem foi feita; false se faltar memria.
+ */
+static bool EnumeraCaminhosCount(CSR* c, int s, int d, const char* estado, int numThreads, uint64_t* caminhos)
+{
+    int n = c->numVertices;
+    *caminhos = 0;
+
+    if (numThreads <= 1)
+    {
+        uint64_t* visitados = (uint64_t*)calloc((n + 63) / 64, sizeof(uint64_t));
+        int* pilha = (int*)malloc(n * sizeof(int));
+        int* cursores = (int*)malloc(n * sizeof(int));
+        bool ok = visitados != NULL && pilha != NULL && cursores != NULL;
+        if (ok)
+        {
+            visitados[s / 64] |= (uint64_t)1 << (s % 64);
+            *caminhos = ContaDesdeCount(c, s, d, estado, visitados, pilha, cursores);
+        }
+        free(visitados);
+        free(pilha);
+        free(cursores);
+        return ok;
+    }
+
+    int* prefixos;
+    int* inicios;
+    int numTarefas = 0;
+    uint64_t encontrados = 0;
+    if (!DivideTarefasCount(c, s, d, estado, TAREFAS_POR_THREAD * numThreads, &prefixos, &inicios, &numTarefas, &encontrados))
+        return false;
+
+    // Distribui as tarefas por blocos contguos, um por thread
+    FilaTarefasCount filas[MAX_THREADS];
+    TrabalhadorCount trabalhadores[MAX_THREADS];
+    bool ok = true;
+    int criadas = 0;
+    for (; criadas < numThreads; criadas++)
+    {
+        filas[criadas].trinco = CreateMutexThread();
+        if (filas[criadas].trinco == NULL)
+        {
+            ok = false;
+            break;
+        }
+        filas[criadas].inicio = (int)((long long)numTarefas * criadas / numThreads);
+        filas[criadas].fim = (int)((long long)numTarefas * (criadas + 1) / numThreads);
+
+        TrabalhadorCount* w = &trabalhadores[criadas];
+        w->c = c;
+        w->d = d;
+        w->estado = estado;
+        w->prefixos = prefixos;
+        w->inicios = inicios;
+        w->filas = filas;
+        w->numThreads = numThreads;
+        w->id = criadas;
+        w->contagem = 0;
+        w->ok = true;
+    }
+
+    if (ok)
+    {
+        RunThreads(numThreads, TrabalhaCount, trabalhadores, sizeof(TrabalhadorCount));
+
+        *caminhos = encontrados;
+        for (int k = 0; k < numThreads; k++)
+        {
+            *caminhos += trabalhadores[k].contagem;
+            if (!trabalhadores[k].ok) ok = false;
+        }
+    }
+
+    for (int k = 0; k < criadas; k++) DestroyMutexThread(filas[k].trinco);
+    free(prefixos);
+    free(inicios);
+    return ok;
+}
+#pragma endregion
+
+
+#pragma region Conta caminhos simples numa estrutura CSR.
+/**
+ * @brief Conta os caminhos simples de s at d: programao dinmica se os vrtices relevantes
+ *        forem acclicos, enumerao podada (com numThreads threads) caso contrrio.
+ */
+static int ContaCaminhosCount(CSR* c, int s, int d, int numThreads, Contagem* total)
+{
+    bool ok;
+    CSR* t = TransposeCSR(c, &ok);
+    if (!ok) return CONTAGEM_ERRO;
+
+    int n = c->numVertices;
+    char* estado = (char*)calloc(n, sizeof(char));       // Bit 1: alcanado pela origem; bit 2: alcana o destino
+    int* fila = (int*)malloc(n * sizeof(int));
+    int* graus = (int*)calloc(n, sizeof(int));
+    Contagem* contagens = (Contagem*)calloc(n, sizeof(Contagem));
+    int resultado = CONTAGEM_ERRO;
+
+    if (estado != NULL && fila != NULL && graus != NULL && contagens != NULL)
+    {
+        MarcaAlcancadosCount(c, s, 1, estado, fila);
+        MarcaAlcancadosCount(t, d, 2, estado, fila);
+
+        // Graus de entrada dentro dos vrtices relevantes
+        int relevantes = 0;
+        for (int u = 0; u < n; u++)
+        {
+            if (estado[u] != 3) continue;
+            relevantes++;
+            for (int e = c->offsets[u]; e < c->offsets[u + 1]; e++)
+                if (estado[c->destinos[e]] == 3) graus[c->destinos[e]]++;
+        }
+
+        if (estado[s] == 3 && graus[s] == 0)
+        {
+            // Algoritmo de Kahn a partir da origem (o nico vrtice relevante sem antecessores)
+            contagens[s].baixo = 1;
+            fila[0] = s;
+            int fim = 1;
+            for (int i = 0; i < fim; i++)
+            {
+                int u = fila[i];
+                for (int e = c->offsets[u]; e < c->offsets[u + 1]; e++)
+                {
+                    int w = c->destinos[e];
+                    if (estado[w] != 3) continue;
+                    AddContagem(&contagens[w], &contagens[u]);
+                    if (--graus[w] == 0) fila[fim++] = w;
+                }
+            }
+
+            if (fim == relevantes)
+            {
+                *total = contagens[d];
+                resultado = CONTAGEM_DAG;
+            }
+        }
+        else if (estado[s] != 3)
+        {
+            resultado = CONTAGEM_DAG; // O destino no  alcanvel: 0 caminhos
+        }
+
+        if (resultado == CONTAGEM_ERRO)
+        {
+            // H um ciclo entre os vrtices relevantes
+            uint64_t caminhos;
+            if (EnumeraCaminhosCount(c, s, d, estado, numThreads, &caminhos))
+            {
+                total->baixo = caminhos;
+                resultado = CONTAGEM_CICLOS;
+            }
+        }
+    }
+
+    free(estado);
+    free(fila);
+    free(graus);
+    free(contagens);
+    DestroyCSR(t, &ok);
+    return resultado;
+}
+#pragma endregion
+
+
+#pragma region ALGORITMOS
+
+/**
+ * @brief Conta os caminhos simples entre dois vrtices de uma estrutura CSR.
+ *
+ * Marca os vrtices alcanveis a partir da origem (procura em largura) e os que alcanam
+ * o destino (procura em largura sobre a estrutura transposta). Se os vrtices com as duas
+ * marcas no tiverem ciclos, percorre-os por ordem topolgica somando em cada vrtice as
+ * contagens dos antecessores, em O(V + E) e com contadores de 128 bits. Caso contrrio,
+ * enumera os caminhos como CountPathsCSR, mas sem entrar em vrtices que no alcanam o destino.
+ *
+ * @param c A estrutura CSR.
+ * @param src O ID do vrtice de origem.
+ * @param dst O ID do vrtice de destino.
+ * @param total A contagem de caminhos (0 em caso de erro).
+ * @return CONTAGEM_DAG, CONTAGEM_CICLOS ou CONTAGEM_ERRO (vrtice inexistente ou falta de memria).
+ */
+int CountPathsDAGCSR(CSR* c, int src, int dst, Contagem* total)
+{
+    return CountPathsParallelCSR(c, src, dst, 1, total);
+}
+
+
+/**
+ * @brief Conta os caminhos simples entre dois vrtices do grafo.
+ *
+ * Congela o grafo (FreezeGraph) e usa CountPathsDAGCSR. Ao contrrio de CountPathsVertices,
+ * no altera o estado "visitado" dos vrtices e no transborda com muitos caminhos.
+ *
+ * @param g O apontador para o grafo.
+ * @param src O ID do vrtice de origem.
+ * @param dst O ID do vrtice de destino.
+ * @param total A contagem de caminhos (0 em caso de erro).
+ * @return CONTAGEM_DAG, CONTAGEM_CICLOS ou CONTAGEM_ERRO (vrtice inexistente ou falta de memria).
+ */
+int CountPathsDAG(Graph* g, int src, int dst, Contagem* total)
+{
+    return CountPathsParallel(g, src, dst, 1, total);
+}
+
+
+/**
+ * @brief Conta os caminhos simples entre dois vrtices de uma estrutura CSR, em vrias threads.
+ *
+ * Igual a CountPathsDAGCSR, mas, quando os vrtices relevantes tm ciclos, a enumerao 
+ * dividida em tarefas (prefixos de caminhos at uma pequena profundidade) executadas por
+ * numThreads threads com roubo de tarefas; cada thread tem o seu prprio vetor de bits de
+ * vrtices visitados, e as contagens so somadas no fim.
+ *
+ * @param c A estrutura CSR.
+ * @param src O ID do vrtice de origem.
+ * @param dst O ID do vrtice de destino.
+ * @param numThreads O nmero de threads (<= 0 para um por processador).
+ * @param total A contagem de caminhos (0 em caso de erro).
+ * @return CONTAGEM_DAG, CONTAGEM_CICLOS ou CONTAGEM_ERRO (vrtice inexistente ou falta de memria).
+ */
+int CountPathsParallelCSR(CSR* c, int src, int dst, int numThreads, Contagem* total)
+{
+    if (total == NULL) return CONTAGEM_ERRO;
+    memset(total, 0, sizeof(Contagem));
+    if (c == NULL) return CONTAGEM_ERRO;
+
+    int s = IndexCSR(c, src);
+    int d = IndexCSR(c, dst);
+    if (s < 0 || d < 0) return CONTAGEM_ERRO;
+    if (s == d)
+    {
+        total->baixo = 1;
+        return CONTAGEM_DAG;
+    }
+
+    return ContaCaminhosCount(c, s, d, ThreadCount(numThreads), total);
+}
+
+
+/**
+ * @brief Conta os caminhos simples entre dois vrtices do grafo, em vrias threads.
+ *
+ * Congela o grafo (FreezeGraph) e usa CountPathsParallelCSR; o estado "visitado" dos
+ * vrtices no  usado, pelo que as threads no partilham estado mutvel.
+ *
+ * @param g O apontador para o grafo.
+ * @param src O ID do vrtice de origem.
+ * @param dst O ID do vrtice de destino.
+ * @param numThreads O nmero de threads (<= 0 para um por processador).
+ * @param total A contagem de caminhos (0 em caso de erro).
+ * @return CONTAGEM_DAG, CONTAGEM_CICLOS ou CONTAGEM_ERRO (vrtice inexistente ou falta de memria).
+ */
+int CountPathsParallel(Graph* g, int src, int dst, int numThreads, Contagem* total)
+{
+    if (total == NULL) return CONTAGEM_ERRO;
+    memset(total, 0, sizeof(Contagem));
+
+    bool ok;
+    CSR* c = FreezeGraph(g, &ok);
+    if (!ok) return CONTAGEM_ERRO;
+
+    int resultado = CountPathsParallelCSR(c, src, dst, numThreads, total);
+    DestroyCSR(c, &ok);
+    return resultado;
+}
+
+#pragma endregion
@@ -0,0 +1,53 @@
+/**
+ * @file   PathCount.h
+ * @brief  Definies da contagem de caminhos simples com contadores de 128 bits.
+ *
+ * S interessam os vrtices relevantes: os alcanveis a partir da origem que tambm
+ * alcanam o destino. Se estes formarem um grafo acclico, o nmero de caminhos  calculado
+ * por programao dinmica sobre a ordem topolgica, em O(V + E); caso contrrio, os caminhos
+ * so enumerados, mas sem nunca entrar num vrtice que no alcana o destino; as verses
+ * paralelas dividem essa enumerao por vrias threads.
+ *
+ * @date   Outubro 2026
+ * @author Hugo Lopes_30516
+ */
+
+#pragma once
+
+#define _CRT_SECURE_NO_WARNINGS
+
+#ifndef PATHCOUNT_H
+#define PATHCOUNT_H
+
+#include <stddef.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include "Graph.h"
+#include "CSR.h"
+
+/* Resultados de CountPathsDAG e CountPathsDAGCSR */
+#define CONTAGEM_ERRO 0     /* Vrtice inexistente ou falta de memria */
+#define CONTAGEM_DAG 1      /* Vrtices relevantes acclicos: contagem por programao dinmica */
+#define CONTAGEM_CICLOS 2   /* Vrtices relevantes com ciclos: contagem por enumerao podada */
+
+/* Tamanho mximo do texto de uma contagem (39 algarismos e o '\0') */
+#define CONTAGEM_TEXTO 40
+
+ /**
+  * @brief Contador sem sinal de 128 bits (portvel, sem depender de __int128).
+  */
+typedef struct Contagem
+{
+    uint64_t baixo;         /* 64 bits menos significativos */
+    uint64_t alto;          /* 64 bits mais significativos */
+    bool transbordou;       /* O valor verdadeiro no cabe em 128 bits */
+} Contagem;
+
+void AddContagem(Contagem* a, const Contagem* b);
+void ContagemToString(const Contagem* c, char* texto, size_t tam);
+int CountPathsDAG(Graph* g, int src, int dst, Contagem* total);
+int CountPathsDAGCSR(CSR* c, int src, int dst, Contagem* total);
+int CountPathsParallel(Graph* g, int src, int dst, int numThreads, Contagem* total);
+int CountPathsParallelCSR(CSR* c, int src, int dst, int numThreads, Contagem* total);
+
+#endif /* PATHCOUNT_H */
@@ -0,0 +1,439 @@
+/**
+ * @file   Query.c
+ * @author Hugo Lopes_30516
+ *
+ * @brief Implementao do contexto de consulta e das procuras que o usam.
+ *
+ * As procuras deste ficheiro no alteram o grafo (nem o campo visitado dos vrtices),
+ * pelo que podem correr em simultneo sobre o mesmo grafo, desde que este no seja
+ * modificado durante as consultas.
+ *
+ * @date   Outubro 2026
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <malloc.h>
+#include <stdbool.h>
+#include "Graph.h"
+#include "CSR.h"
+#include "Query.h"
+
+
+#pragma region Cria um contexto de consulta.
+/**
+ * @brief Cria um contexto de consulta com posies para o nmero de vrtices indicado.
+ *
+ * @param q Apontador para o contexto a inicializar.
+ * @param capacidade Nmero de vrtices esperado (o vetor cresce em BeginQuery, se necessrio).
+ * @return true se a alocao foi bem-sucedida; false caso contrrio.
+ */
+bool CreateQueryContext(QueryContext* q, int capacidade)
+{
+    if (q == NULL) return false;
+    if (capacidade < 16) capacidade = 16;
+
+    q->marcas = (unsigned int*)calloc(capacidade, sizeof(unsigned int));
+    q->marcasInversas = (unsigned int*)calloc(capacidade, sizeof(unsigned int));
+    q->pilha = (int*)malloc(capacidade * sizeof(int));
+    q->cursores = (Adjacent**)malloc(capacidade * sizeof(Adjacent*));
+    q->capacidade = capacidade;
+    q->epoca = 0;
+    if (q->marcas == NULL || q->marcasInversas == NULL || q->pilha == NULL || q->cursores == NULL)
+    {
+        DestroyQueryContext(q);
+        return false;
+    }
+    return true;
+}
+#pragma endregion
+
+
+#pragma region Liberta a memria de um contexto de consulta.
+/**
+ * @brief Liberta a memria de um contexto de consulta.
+ *
+ * @param q Apontador para o contexto.
+ */
+void DestroyQueryContext(QueryContext* q)
+{
+    if (q == NULL) return;
+
+    free(q->marcas);
+    free(q->marcasInversas);
+    free(q->pilha);
+    free(q->cursores);
+    q->marcas = NULL;
+    q->marcasInversas = NULL;
+    q->pilha = NULL;
+    q->cursores = NULL;
+    q->capacidade = 0;
+    q->epoca = 0;
+}
+#pragma endregion
+
+
+#pragma region Prepara o contexto para uma nova consulta.
+/**
+ * @brief Garante posies para numVertices vrtices e comea uma nova poca.
+ *
+ * Normalmente basta incrementar a poca; os vetores s so limpos quando a poca d a volta
+ * (a cada 2^32 - 1 consultas) e s crescem se houver mais vrtices do que posies.
+ */
+static bool PreparaQuery(QueryContext* q, int numVertices)
+{
+    if (numVertices > q->capacidade)
+    {
+        int novaCap = q->capacidade * 2;
+        if (novaCap < numVertices) novaCap = numVertices;
+
+        unsigned int** vetores[2] = { &q->marcas, &q->marcasInversas };
+        for (int i = 0; i < 2; i++)
+        {
+            unsigned int* novo = (unsigned int*)realloc(*vetores[i], novaCap * sizeof(unsigned int));
+            if (novo == NULL) return false;
+            memset(novo + q->capacidade, 0, (novaCap - q->capacidade) * sizeof(unsigned int));
+            *vetores[i] = novo;
+        }
+
+        int* pilha = (int*)realloc(q->pilha, novaCap * sizeof(int));
+        if (pilha == NULL) return false;
+        q->pilha = pilha;
+
+        Adjacent** cursores = (Adjacent**)realloc(q->cursores, novaCap * sizeof(Adjacent*));
+        if (cursores == NULL) return false;
+        q->cursores = cursores;
+        q->capacidade = novaCap;
+    }
+
+    if (++q->epoca == 0)
+    {
+        memset(q->marcas, 0, q->capacidade * sizeof(unsigned int));
+        memset(q->marcasInversas, 0, q->capacidade * sizeof(unsigned int));
+        q->epoca = 1;
+    }
+    return true;
+}
+#pragma endregion
+
+
+#pragma region Comea uma nova consulta.
+/**
+ * @brief Comea uma nova consulta sobre o grafo: todos os vrtices passam a no visitados.
+ *
+ * @param q O contexto de consulta.
+ * @param G O grafo a consultar.
+ * @return true se o contexto est pronto; false se faltar memria.
+ */
+bool BeginQuery(QueryContext* q, Graph* G)
+{
+    if (q == NULL || G == NULL) return false;
+    return PreparaQuery(q, G->numeroVertices);
+}
+#pragma endregion
+
+
+#pragma region Comea uma nova consulta sobre uma estrutura CSR.
+/**
+ * @brief Comea uma nova consulta sobre uma estrutura CSR (posies = ndices dos vrtices).
+ *
+ * @param q O contexto de consulta.
+ * @param c A estrutura CSR a consultar.
+ * @return true se o contexto est pronto; false se faltar memria.
+ */
+bool BeginQueryCSR(QueryContext* q, CSR* c)
+{
+    if (q == NULL || c == NULL) return false;
+    return PreparaQuery(q, c->numVertices);
+}
+#pragma endregion
+
+
+#pragma region ALGORITMOS
+
+/**
+ * @brief Procura a partir de um vrtice pela pilha (profundidade) ou pela fila (largura) do contexto.
+ *
+ * Cada vrtice entra uma nica vez ( marcado ao entrar), pelo que q->pilha chega para
+ * a pilha e para a fila.
+ */
+static bool ProcuraQuery(Graph* g, QueryContext* q, Node* inicio, int dest, bool largura)
+{
+    q->marcas[inicio->slot] = q->epoca;
+    q->pilha[0] = inicio->slot;
+    int frente = 0, fim = 1;
+
+    while (frente < fim)
+    {
+        // Em largura retira da frente da fila; em profundidade retira do topo da pilha
+        int u = largura ? q->pilha[frente++] : q->pilha[--fim];
+        for (Adjacent* hAdj = g->slots[u]->nextAdjacent; hAdj != NULL; hAdj = hAdj->next)
+        {
+            Node* v = FindHashVertice(&g->indice, hAdj->id);
+            if (v == NULL || q->marcas[v->slot] == q->epoca) continue;
+            if (v->id == dest) return true;
+
+            q->marcas[v->slot] = q->epoca; // Marca o vrtice como visitado nesta consulta
+            q->pilha[fim++] = v->slot;
+        }
+    }
+    return false;
+}
+
+
+/**
+ * @brief Busca em Profundidade com contexto de consulta.
+ *
+ * Equivalente a DepthFirstSearchRec, mas o estado "visitado" fica no contexto de consulta,
+ * pelo que no  preciso chamar ResetVerticesVisitados antes.  iterativa, com a pilha do
+ * contexto, pelo que tambm pode correr em threads com pilhas de execuo pequenas.
+ *
+ * @param g O apontador para o grafo onde ser realizada a busca.
+ * @param q O contexto de consulta (um por thread).
+ * @param origem O ID do vrtice de origem.
+ * @param dest O ID do vrtice de destino.
+ * @return Retorna true se existir um caminho entre os vrtices de origem e destino, false caso contrrio.
+ */
+bool DepthFirstSearchQuery(Graph* g, QueryContext* q, int origem, int dest)
+{
+    if (origem == dest) return true; // Retorna true se a origem for igual ao destino
+    if (g == NULL || !BeginQuery(q, g)) return false;
+
+    Node* aux = FindHashVertice(&g->indice, origem);
+    if (aux == NULL) return false;
+
+    return ProcuraQuery(g, q, aux, dest, false);
+}
+
+
+/**
+ * @brief Busca em Largura com contexto de consulta.
+ *
+ * Tal como DepthFirstSearchQuery, mas visita os vrtices por ordem de distncia (em nmero
+ * de adjacncias)  origem, usando a pilha do contexto como fila: encontra mais cedo
+ * destinos prximos da origem.
+ *
+ * @param g O apontador para o grafo onde ser realizada a busca.
+ * @param q O contexto de consulta (um por thread).
+ * @param origem O ID do vrtice de origem.
+ * @param dest O ID do vrtice de destino.
+ * @return Retorna true se existir um caminho entre os vrtices de origem e destino, false caso contrrio.
+ */
+bool BreadthFirstSearchQuery(Graph* g, QueryContext* q, int origem, int dest)
+{
+    if (origem == dest) return true; // Retorna true se a origem for igual ao destino
+    if (g == NULL || !BeginQuery(q, g)) return false;
+
+    Node* aux = FindHashVertice(&g->indice, origem);
+    if (aux == NULL) return false;
+
+    return ProcuraQuery(g, q, aux, dest, true);
+}
+
+
+/**
+ * @brief Procura bidirecional com contexto de consulta.
+ *
+ * Avana em largura a partir da origem (adjacncias de sada) e a partir do destino
+ * (adjacncias de entrada), um nvel de cada vez, expandindo sempre a fronteira mais pequena;
+ * termina quando um vrtice  alcanado pelas duas procuras. Em grafos de dimetro pequeno
+ * visita muito menos vrtices do que uma procura s a partir da origem.
+ * As duas filas partilham q->pilha: a da origem cresce do incio, a do destino do fim
+ * (cada vrtice entra no mximo numa delas, pois ao ser alcanado pela outra a procura termina).
+ * Sem as listas de entrada (ver IncomingEdgesGraph), faz uma busca em largura normal.
+ *
+ * @param g O apontador para o grafo onde ser realizada a busca.
+ * @param q O contexto de consulta (um por thread).
+ * @param origem O ID do vrtice de origem.
+ * @param dest O ID do vrtice de destino.
+ * @return Retorna true se existir um caminho entre os vrtices de origem e destino, false caso contrrio.
+ */
+bool BidirectionalSearchQuery(Graph* g, QueryContext* q, int origem, int dest)
+{
+    if (origem == dest) return true; // Retorna true se a origem for igual ao destino
+    if (g == NULL) return false;
+    if (!g->comEntradas) return BreadthFirstSearchQuery(g, q, origem, dest);
+    if (!BeginQuery(q, g)) return false;
+
+    Node* s = FindHashVertice(&g->indice, origem);
+    Node* d = FindHashVertice(&g->indice, dest);
+    if (s == NULL || d == NULL) return false;
+
+    unsigned int epoca = q->epoca;
+    int cap = q->capacidade;
+    q->marcas[s->slot] = epoca;
+    q->marcasInversas[d->slot] = epoca;
+    q->pilha[0] = s->slot;
+    q->pilha[cap - 1] = d->slot;
+
+    // Fila da origem: pilha[ini .. fim-1]; fila do destino: pilha[fimInv+1 .. iniInv]
+    int ini = 0, fim = 1;
+    int iniInv = cap - 1, fimInv = cap - 2;
+
+    while (ini < fim && iniInv > fimInv)
+    {
+        if (fim - ini <= iniInv - fimInv)
+        {
+            // Expande um nvel da procura a partir da origem
+            int nivel = fim;
+            while (ini < nivel)
+            {
+                Node* u = g->slots[q->pilha[ini++]];
+                for (Adjacent* hAdj = u->nextAdjacent; hAdj != NULL; hAdj = hAdj->next)
+                {
+                    Node* v = FindHashVertice(&g->indice, hAdj->id);
+                    if (v == NULL || q->marcas[v->slot] == epoca) continue;
+                    if (q->marcasInversas[v->slot] == epoca) return true; // As procuras encontraram-se
+                    q->marcas[v->slot] = epoca;
+                    q->pilha[fim++] = v->slot;
+                }
+            }
+        }
+        else
+        {
+            // Expande um nvel da procura a partir do destino
+            int nivel = fimInv;
+            while (iniInv > nivel)
+            {
+                Node* u = g->slots[q->pilha[iniInv--]];
+                for (Adjacent* hAdj = u->entradas; hAdj != NULL; hAdj = hAdj->next)
+                {
+                    Node* v = FindHashVertice(&g->indice, hAdj->id);
+                    if (v == NULL || q->marcasInversas[v->slot] == epoca) continue;
+                    if (q->marcas[v->slot] == epoca) return true; // As procuras encontraram-se
+                    q->marcasInversas[v->slot] = epoca;
+                    q->pilha[fimInv--] = v->slot;
+                }
+            }
+        }
+    }
+    return false;
+}
+
+
+/**
+ * @brief Procura bidirecional sobre uma estrutura CSR e a sua transposta.
+ *
+ * Equivalente a BidirectionalSearchQuery; as adjacncias de entrada so as da estrutura
+ * transposta t (ver TransposeCSR), criada uma vez para todas as consultas.
+ *
+ * @param c A estrutura CSR.
+ * @param t A estrutura CSR transposta de c.
+ * @param q O contexto de consulta (um por thread).
+ * @param origem O ID do vrtice de origem.
+ * @param dest O ID do vrtice de destino.
+ * @return Retorna true se existir um caminho entre os vrtices de origem e destino, false caso contrrio.
+ */
+bool BidirectionalSearchCSR(CSR* c, CSR* t, QueryContext* q, int origem, int dest)
+{
+    if (origem == dest) return true; // Retorna true se a origem for igual ao destino
+    if (c == NULL || t == NULL || t->numVertices != c->numVertices || !BeginQueryCSR(q, c)) return false;
+
+    int s = IndexCSR(c, origem);
+    int d = IndexCSR(c, dest);
+    if (s < 0 || d < 0) return false;
+
+    unsigned int epoca = q->epoca;
+    int cap = q->capacidade;
+    q->marcas[s] = epoca;
+    q->marcasInversas[d] = epoca;
+    q->pilha[0] = s;
+    q->pilha[cap - 1] = d;
+
+    int ini = 0, fim = 1;
+    int iniInv = cap - 1, fimInv = cap - 2;
+
+    while (ini < fim && iniInv > fimInv)
+    {
+        if (fim - ini <= iniInv - fimInv)
+        {
+            int nivel = fim;
+            while (ini < nivel)
+            {
+                int u = q->pilha[ini++];
+                for (int e = c->offsets[u]; e < c->offsets[u + 1]; e++)
+                {
+                    int w = c->destinos[e];
+                    if (q->marcas[w] == epoca) continue;
+                    if (q->marcasInversas[w] == epoca) return true;
+                    q->marcas[w] = epoca;
+                    q->pilha[fim++] = w;
+                }
+            }
+        }
+        else
+        {
+            int nivel = fimInv;
+            while (iniInv > nivel)
+            {
+                int u = q->pilha[iniInv--];
+                for (int e = t->offsets[u]; e < t->offsets[u + 1]; e++)
+                {
+                    int w = t->destinos[e];
+                    if (q->marcasInversas[w] == epoca) continue;
+                    if (q->marcas[w] == epoca) return true;
+                    q->marcasInversas[w] = epoca;
+                    q->pilha[fimInv--] = w;
+                }
+            }
+        }
+    }
+    return false;
+}
+
+
+/**
+ * @brief Conta o nmero de caminhos simples entre dois vrtices com contexto de consulta.
+ *
+ * Equivalente a CountPathsVertices, sem ResetVerticesVisitados nem alteraes ao grafo.
+ * O caminho atual fica na pilha do contexto e a prxima adjacncia a seguir em cada
+ * vrtice do caminho em q->cursores.
+ *
+ * @param g O apontador para o grafo onde ser feita a contagem de caminhos.
+ * @param q O contexto de consulta (um por thread).
+ * @param src O ID do vrtice de origem.
+ * @param dst O ID do vrtice de destino.
+ * @return O nmero total de caminhos entre os vrtices de origem e destino.
+ */
+int CountPathsQuery(Graph* g, QueryContext* q, int src, int dst)
+{
+    if (g == NULL) return 0;
+    if (src == dst) return 1;
+    if (!BeginQuery(q, g)) return 0;
+
+    Node* aux = FindHashVertice(&g->indice, src);
+    if (aux == NULL) return 0;
+
+    int pathCount = 0;
+    q->marcas[aux->slot] = q->epoca;
+    q->pilha[0] = aux->slot;
+    q->cursores[0] = aux->nextAdjacent;
+    int topo = 1;
+
+    while (topo > 0)
+    {
+        Adjacent* hAdj = q->cursores[topo - 1];
+        if (hAdj == NULL)
+        {
+            q->marcas[q->pilha[--topo]] = 0; // Desmarca o vrtice para permitir outros caminhos
+            continue;
+        }
+        q->cursores[topo - 1] = hAdj->next;
+
+        Node* v = FindHashVertice(&g->indice, hAdj->id);
+        if (v == NULL || q->marcas[v->slot] == q->epoca) continue;
+        if (v->id == dst)
+        {
+            pathCount++;
+            continue;
+        }
+
+        q->marcas[v->slot] = q->epoca; // Acrescenta o vrtice ao caminho atual
+        q->pilha[topo] = v->slot;
+        q->cursores[topo++] = v->nextAdjacent;
+    }
+
+    return pathCount;
+}
+
+#pragma endregion
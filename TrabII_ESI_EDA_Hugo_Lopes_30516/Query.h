@@ -0,0 +1,49 @@
+/**
+ * @file   Query.h
+ * @brief  Definies do contexto de consulta: estado "visitado" prprio de cada consulta.
+ *
+ * Em vez do campo visitado dos vrtices, cada consulta marca os vrtices num vetor indexado
+ * pela posio densa do vrtice (Node::slot), com o nmero da consulta (poca) em que foram
+ * visitados. Comear uma nova consulta  s incrementar a poca, e vrias threads podem
+ * percorrer o mesmo grafo ao mesmo tempo, cada uma com o seu contexto. O contexto tem tambm
+ * a pilha (ou fila) das procuras iterativas, reservada uma vez e reutilizada em cada consulta.
+ *
+ * @date   Outubro 2026
+ * @author Hugo Lopes_30516
+ */
+
+#pragma once
+
+#define _CRT_SECURE_NO_WARNINGS
+
+#ifndef QUERY_H
+#define QUERY_H
+
+#include <stdbool.h>
+#include "Graph.h"
+#include "CSR.h"
+
+ /**
+  * @brief Estrutura para representar o contexto de uma consulta sobre um grafo.
+  */
+typedef struct QueryContext
+{
+    unsigned int* marcas;   /* poca em que cada posio densa foi visitada */
+    unsigned int* marcasInversas; /* poca em que cada posio foi visitada a partir do destino */
+    int* pilha;             /* Pilha (ou fila) de posies das procuras iterativas */
+    Adjacent** cursores;    /* Prxima adjacncia de cada vrtice do caminho atual (CountPathsQuery) */
+    int capacidade;         /* Nmero de posies de cada vetor */
+    unsigned int epoca;     /* poca da consulta atual (nunca  0) */
+} QueryContext;
+
+bool CreateQueryContext(QueryContext* q, int capacidade);
+void DestroyQueryContext(QueryContext* q);
+bool BeginQuery(QueryContext* q, Graph* G);
+bool BeginQueryCSR(QueryContext* q, CSR* c);
+bool DepthFirstSearchQuery(Graph* g, QueryContext* q, int origem, int dest);
+bool BreadthFirstSearchQuery(Graph* g, QueryContext* q, int origem, int dest);
+bool BidirectionalSearchQuery(Graph* g, QueryContext* q, int origem, int dest);
+bool BidirectionalSearchCSR(CSR* c, CSR* t, QueryContext* q, int origem, int dest);
+int CountPathsQuery(Graph* g, QueryContext* q, int src, int dst);
+
+#endif /* QUERY_H */
@@ -0,0 +1,461 @@
+/**
+ * @file   ReachIndex.c
+ * @author Hugo Lopes_30516
+ *
+ * @brief Implementao do ndice de alcanabilidade.
+ *
+ * @date   Outubro 2026
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <malloc.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include "CSR.h"
+#include "Threads.h"
+#include "ReachIndex.h"
+
+ /**
+  * @brief Argumento de cada thread da construo dos vetores de bits.
+  *
+  * Cada thread calcula as palavras primeira .. ultima-1 de todas as linhas, pelo que
+  * as threads nunca escrevem nas mesmas posies.
+  */
+typedef struct
+{
+    ReachIndex* r;          /* ndice em construo */
+    const int* offsets;     /* Incio das componentes sucessoras de cada componente */
+    const int* sucessores;  /* Componentes sucessoras (sem repeties) */
+    int primeira;           /* Primeira palavra desta thread */
+    int ultima;             /* Palavra a seguir  ltima desta thread */
+} ParteReach;
+
+
+#pragma region Componentes fortemente conexas.
+/**
+ * @brief Calcula as componentes fortemente conexas (algoritmo de Tarjan, iterativo).
+ *
+ * As componentes ficam numeradas pela ordem em que so fechadas, que  uma ordem
+ * topolgica inversa do grafo das componentes.
+ *
+ * @return O nmero de componentes, ou -1 se faltar memria.
+ */
+static int ComponentesReach(CSR* c, int* componentes)
+{
+    int n = c->numVertices;
+    int tam = (n > 0) ? n : 1;
+    int* ordem = (int*)malloc(tam * sizeof(int));       // Ordem de descoberta de cada vrtice (-1 por descobrir)
+    int* menor = (int*)malloc(tam * sizeof(int));       // Menor ordem alcanvel pela subrvore
+    int* pilha = (int*)malloc(tam * sizeof(int));       // Vrtices ainda sem componente
+    int* chamadas = (int*)malloc(tam * sizeof(int));    // Caminho atual da procura em profundidade
+    int* cursores = (int*)malloc(tam * sizeof(int));    // Prxima adjacncia de cada vrtice do caminho
+    int numComp = -1;
+
+    if (ordem != NULL && menor != NULL && pilha != NULL && chamadas != NULL && cursores != NULL)
+    {
+        for (int v = 0; v < n; v++)
+        {
+            ordem[v] = -1;
+            componentes[v] = -1;
+        }
+
+        int contador = 0, topo = 0;
+        numComp = 0;
+        for (int raiz = 0; raiz < n; raiz++)
+        {
+            if (ordem[raiz] >= 0) continue;
+
+            ordem[raiz] = menor[raiz] = contador++;
+            pilha[topo++] = raiz;
+            chamadas[0] = raiz;
+            cursores[0] = c->offsets[raiz];
+            int prof = 1;
+
+            while (prof > 0)
+            {
+                int v = chamadas[prof - 1];
+                if (cursores[prof - 1] < c->offsets[v + 1])
+                {
+                    int w = c->destinos[cursores[prof - 1]++];
+                    if (ordem[w] < 0)
+                    {
+                        // Desce para w
+                        ordem[w] = menor[w] = contador++;
+                        pilha[topo++] = w;
+                        chamadas[prof] = w;
+                        cursores[prof++] = c->offsets[w];
+                    }
+                    else if (componentes[w] < 0 && ordem[w] < menor[v])
+                    {
+                        menor[v] = ordem[w]; // w ainda est na pilha
+                    }
+                    continue;
+                }
+
+                // Todas as adjacncias de v foram seguidas
+                prof--;
+                if (menor[v] == ordem[v])
+                {
+                    // v  a raiz de uma componente: retira-a da pilha
+                    int w;
+                    do
+                    {
+                        w = pilha[--topo];
+                        componentes[w] = numComp;
+                    } while (w != v);
+                    numComp++;
+                }
+                if (prof > 0)
+                {
+                    int pai = chamadas[prof - 1];
+                    if (menor[v] < menor[pai]) menor[pai] = menor[v];
+                }
+            }
+        }
+    }
+
+    free(ordem);
+    free(menor);
+    free(pilha);
+    free(chamadas);
+    free(cursores);
+    return numComp;
+}
+#pragma endregion
+
+
+#pragma region Calcula parte dos vetores de bits.
+/**
+ * @brief Tarefa de cada thread: calcula as suas palavras de todas as linhas, por ordem das componentes.
+ *
+ * Como as sucessoras de uma componente tm nmero menor, as suas linhas j esto calculadas.
+ */
+static void CalculaParteReach(void* argumento)
+{
+    ParteReach* p = (ParteReach*)argumento;
+    ReachIndex* r = p->r;
+    int palavras = r->palavras;
+
+    for (int i = 0; i < r->numComponentes; i++)
+    {
+        uint64_t* linha = r->alcance + (size_t)i * palavras;
+        for (int w = p->primeira; w < p->ultima; w++) linha[w] = 0;
+
+        // A componente alcana-se a si prpria
+        if (i / 64 >= p->primeira && i / 64 < p->ultima) linha[i / 64] |= (uint64_t)1 << (i % 64);
+
+        for (int e = p->offsets[i]; e < p->offsets[i + 1]; e++)
+        {
+            const uint64_t* outra = r->alcance + (size_t)p->sucessores[e] * palavras;
+            for (int w = p->primeira; w < p->ultima; w++) linha[w] |= outra[w];
+        }
+    }
+}
+#pragma endregion
+
+
+#pragma region Constri um ndice de alcanabilidade.
+/**
+ * @brief Constri o ndice de alcanabilidade de uma estrutura CSR.
+ *
+ * Calcula as componentes fortemente conexas, o grafo das componentes (sem adjacncias
+ * repetidas) e, para cada componente, o vetor de bits das componentes que alcana.
+ * Os vetores de bits so divididos por palavras entre as threads, pelo que a construo
+ * no precisa de sincronizao. O custo  O(V + E) para as componentes e
+ * O(C * (C + Ec) / 64) para os vetores de bits (C componentes, Ec adjacncias entre elas).
+ *
+ * @param c A estrutura CSR.
+ * @param numThreads O nmero de threads (<= 0 para um por processador).
+ * @param erro Apontador (ou NULL) que recebe REACH_SEM_ERRO ou o motivo da falha; com
+ *             REACH_ERRO_COMPONENTES o grafo tem mais de REACH_MAX_COMPONENTES componentes e
+ *             as consultas devem ser feitas sem ndice.
+ * @param res Apontador para um booleano que indica se a operao foi bem-sucedida.
+ * @return Um apontador para o ndice criado, ou NULL em caso de erro.
+ */
+ReachIndex* BuildReachIndex(CSR* c, int numThreads, int* erro, bool* res)
+{
+    int codigo;
+    if (erro == NULL) erro = &codigo;
+    *erro = REACH_ERRO_ARGUMENTOS;
+    *res = false;
+    if (c == NULL) return NULL;
+
+    *erro = REACH_ERRO_MEMORIA;
+    ReachIndex* r = (ReachIndex*)calloc(1, sizeof(ReachIndex));
+    if (r == NULL) return NULL;
+
+    int n = c->numVertices;
+    int tam = (n > 0) ? n : 1;
+    r->numVertices = n;
+    r->ids = (int*)malloc(tam * sizeof(int));
+    r->componentes = (int*)malloc(tam * sizeof(int));
+    if (r->ids == NULL || r->componentes == NULL)
+    {
+        DestroyReachIndex(r, res);
+        *res = false;
+        return NULL;
+    }
+    memcpy(r->ids, c->ids, n * sizeof(int));
+
+    int numComp = ComponentesReach(c, r->componentes);
+    if (numComp < 0)
+    {
+        DestroyReachIndex(r, res);
+        *res = false;
+        return NULL;
+    }
+    if (numComp > REACH_MAX_COMPONENTES)
+    {
+        DestroyReachIndex(r, res);
+        *erro = REACH_ERRO_COMPONENTES;
+        *res = false;
+        return NULL;
+    }
+    r->numComponentes = numComp;
+    r->palavras = (numComp + 63) / 64;
+
+    size_t bytes = (size_t)numComp * r->palavras * sizeof(uint64_t);
+    r->alcance = (uint64_t*)malloc(bytes > 0 ? bytes : 1);
+
+    // Grafo das componentes: vrtices agrupados por componente e adjacncias sem repeties
+    int* offsets = (int*)calloc((size_t)numComp + 1, sizeof(int));
+    int* sucessores = (int*)malloc((c->numArestas > 0 ? c->numArestas : 1) * sizeof(int));
+    int* membros = (int*)malloc(tam * sizeof(int));
+    int* marca = (int*)malloc((numComp > 0 ? numComp : 1) * sizeof(int));
+    bool ok = r->alcance != NULL && offsets != NULL && sucessores != NULL && membros != NULL && marca != NULL;
+
+    if (ok)
+    {
+        // Ordenao por contagem dos vrtices pela sua componente (offsets serve de cursor)
+        for (int v = 0; v < n; v++) offsets[r->componentes[v] + 1]++;
+        for (int i = 0; i < numComp; i++) offsets[i + 1] += offsets[i];
+        for (int v = 0; v < n; v++) membros[offsets[r->componentes[v]]++] = v;
+
+        // Depois da distribuio, offsets[i]  o fim dos membros da componente i
+        int pos = 0, inicio = 0;
+        for (int i = 0; i < numComp; i++) marca[i] = -1;
+        for (int i = 0; i < numComp; i++)
+        {
+            int fim = offsets[i];
+            offsets[i] = pos;
+            for (int m = inicio; m < fim; m++)
+            {
+                int u = membros[m];
+                for (int e = c->offsets[u]; e < c->offsets[u + 1]; e++)
+                {
+                    int j = r->componentes[c->destinos[e]];
+                    if (j == i || marca[j] == i) continue;
+                    marca[j] = i;
+                    sucessores[pos++] = j;
+                }
+            }
+            inicio = fim;
+        }
+        offsets[numComp] = pos;
+
+        // Divide as palavras pelas threads
+        int t = ThreadCount(numThreads);
+        if (t > r->palavras) t = (r->palavras > 0) ? r->palavras : 1;
+        ParteReach partes[MAX_THREADS];
+        for (int k = 0; k < t; k++)
+        {
+            partes[k].r = r;
+            partes[k].offsets = offsets;
+            partes[k].sucessores = sucessores;
+            partes[k].primeira = (int)((long long)r->palavras * k / t);
+            partes[k].ultima = (int)((long long)r->palavras * (k + 1) / t);
+        }
+        RunThreads(t, CalculaParteReach, partes, sizeof(ParteReach));
+    }
+
+    free(offsets);
+    free(sucessores);
+    free(membros);
+    free(marca);
+    if (!ok)
+    {
+        DestroyReachIndex(r, res);
+        *res = false;
+        return NULL;
+    }
+
+    *erro = REACH_SEM_ERRO;
+    *res = true;
+    return r;
+}
+#pragma endregion
+
+
+#pragma region Liberta a memria de um ndice de alcanabilidade.
+/**
+ * @brief Liberta a memria de um ndice de alcanabilidade.
+ *
+ * @param r O ndice a libertar.
+ * @param res Apontador para um booleano que indica se a operao foi bem-sucedida.
+ * @return NULL (no h mais ndice para apontar).
+ */
+ReachIndex* DestroyReachIndex(ReachIndex* r, bool* res)
+{
+    if (r == NULL)
+    {
+        *res = false;
+        return NULL;
+    }
+
+    free(r->ids);
+    free(r->componentes);
+    free(r->alcance);
+    free(r);
+
+    *res = true;
+    return NULL;
+}
+#pragma endregion
+
+
+#pragma region Procura o ndice de um vrtice.
+/**
+ * @brief Devolve o ndice do vrtice com o ID indicado (pesquisa binria), ou -1 se no existir.
+ */
+static int IndexReach(ReachIndex* r, int id)
+{
+    int inf = 0, sup = r->numVertices - 1;
+    while (inf <= sup)
+    {
+        int meio = inf + (sup - inf) / 2;
+        if (r->ids[meio] == id) return meio;
+        if (r->ids[meio] < id) inf = meio + 1;
+        else sup = meio - 1;
+    }
+    return -1;
+}
+#pragma endregion
+
+
+#pragma region Verifica se existe um caminho entre dois vrtices.
+/**
+ * @brief Verifica se existe um caminho entre dois vrtices, consultando o ndice.
+ *
+ * Equivalente a DepthFirstSearchRec: depois de encontrar os dois vrtices, a resposta 
+ * a leitura de um bit.
+ *
+ * @param r O ndice de alcanabilidade.
+ * @param origem O ID do vrtice de origem.
+ * @param dest O ID do vrtice de destino.
+ * @return Retorna true se existir um caminho entre os vrtices de origem e destino, false caso contrrio.
+ */
+bool ReachableIndex(ReachIndex* r, int origem, int dest)
+{
+    if (origem == dest) return true; // Retorna true se a origem for igual ao destino
+    if (r == NULL) return false;
+
+    int s = IndexReach(r, origem);
+    int d = IndexReach(r, dest);
+    if (s < 0 || d < 0) return false;
+
+    int i = r->componentes[s], j = r->componentes[d];
+    return (r->alcance[(size_t)i * r->palavras + j / 64] >> (j % 64)) & 1;
+}
+#pragma endregion
+
+
+#pragma region Guarda um ndice de alcanabilidade num ficheiro.
+/**
+ * @brief Guarda o ndice num ficheiro binrio (normalmente junto ao ficheiro do grafo).
+ *
+ * @param r O ndice a guardar.
+ * @param ficheiro O nome do ficheiro.
+ * @return true se o ficheiro foi escrito; false caso contrrio.
+ */
+bool SaveReachIndex(ReachIndex* r, const char* ficheiro)
+{
+    if (r == NULL) return false;
+
+    FILE* fp = fopen(ficheiro, "wb");
+    if (fp == NULL) return false;
+
+    ReachFileHeader cab;
+    memset(&cab, 0, sizeof(cab));
+    memcpy(cab.magico, REACHFILE_MAGICO, sizeof(cab.magico));
+    cab.versao = REACHFILE_VERSAO;
+    cab.numVertices = r->numVertices;
+    cab.numComponentes = r->numComponentes;
+    cab.palavras = r->palavras;
+
+    size_t numBits = (size_t)r->numComponentes * r->palavras;
+    bool ok = fwrite(&cab, sizeof(cab), 1, fp) == 1
+        && fwrite(r->ids, sizeof(int), r->numVertices, fp) == (size_t)r->numVertices
+        && fwrite(r->componentes, sizeof(int), r->numVertices, fp) == (size_t)r->numVertices
+        && fwrite(r->alcance, sizeof(uint64_t), numBits, fp) == numBits;
+
+    if (fclose(fp) != 0) ok = false;
+    return ok;
+}
+#pragma endregion
+
+
+#pragma region Carrega um ndice de alcanabilidade de um ficheiro.
+/**
+ * @brief Carrega um ndice guardado com SaveReachIndex.
+ *
+ * @param ficheiro O nome do ficheiro.
+ * @param res Apontador para um booleano que indica se a operao foi bem-sucedida.
+ * @return Um apontador para o ndice carregado, ou NULL se o ficheiro no existir,
+ *         no for um ndice desta verso, estiver incompleto ou faltar memria.
+ */
+ReachIndex* LoadReachIndex(const char* ficheiro, bool* res)
+{
+    *res = false;
+
+    FILE* fp = fopen(ficheiro, "rb");
+    if (fp == NULL) return NULL;
+
+    ReachFileHeader cab;
+    if (fread(&cab, sizeof(cab), 1, fp) != 1 || memcmp(cab.magico, REACHFILE_MAGICO, sizeof(cab.magico)) != 0
+        || cab.versao != REACHFILE_VERSAO || cab.numVertices < 0 || cab.numComponentes < 0
+        || cab.numComponentes > cab.numVertices || cab.numComponentes > REACH_MAX_COMPONENTES || cab.palavras != (cab.numComponentes + 63) / 64)
+    {
+        fclose(fp);
+        return NULL;
+    }
+
+    ReachIndex* r = (ReachIndex*)calloc(1, sizeof(ReachIndex));
+    if (r == NULL)
+    {
+        fclose(fp);
+        return NULL;
+    }
+
+    int tam = (cab.numVertices > 0) ? cab.numVertices : 1;
+    size_t numBits = (size_t)cab.numComponentes * cab.palavras;
+    r->numVertices = cab.numVertices;
+    r->numComponentes = cab.numComponentes;
+    r->palavras = cab.palavras;
+    r->ids = (int*)malloc(tam * sizeof(int));
+    r->componentes = (int*)malloc(tam * sizeof(int));
+    r->alcance = (uint64_t*)malloc((numBits > 0 ? numBits : 1) * sizeof(uint64_t));
+
+    bool ok = r->ids != NULL && r->componentes != NULL && r->alcance != NULL
+        && fread(r->ids, sizeof(int), r->numVertices, fp) == (size_t)r->numVertices
+        && fread(r->componentes, sizeof(int), r->numVertices, fp) == (size_t)r->numVertices
+        && fread(r->alcance, sizeof(uint64_t), numBits, fp) == numBits;
+    fclose(fp);
+
+    // Cada vrtice tem de pertencer a uma componente vlida
+    for (int v = 0; ok && v < r->numVertices; v++)
+    {
+        if ((unsigned)r->componentes[v] >= (unsigned)r->numComponentes) ok = false;
+    }
+    if (!ok)
+    {
+        DestroyReachIndex(r, res);
+        *res = false;
+        return NULL;
+    }
+
+    *res = true;
+    return r;
+}
+#pragma endregion
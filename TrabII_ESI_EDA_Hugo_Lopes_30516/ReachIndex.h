@@ -0,0 +1,81 @@
+/**
+ * @file   ReachIndex.h
+ * @brief  Definies do ndice de alcanabilidade (componentes fortemente conexas + fecho transitivo).
+ *
+ * O ndice  construdo uma vez a partir de uma estrutura CSR: os vrtices so agrupados nas
+ * suas componentes fortemente conexas (algoritmo de Tarjan), o grafo das componentes (acclico)
+ *  percorrido por ordem topolgica inversa e cada componente fica com um vetor de bits com as
+ * componentes que alcana. Uma consulta "existe caminho de A para B" passa a ser a leitura
+ * de um bit.
+ *
+ * @date   Outubro 2026
+ * @author Hugo Lopes_30516
+ */
+
+#pragma once
+
+#define _CRT_SECURE_NO_WARNINGS
+
+#ifndef REACHINDEX_H
+#define REACHINDEX_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "CSR.h"
+
+/* Identificao e verso do ficheiro com um ndice de alcanabilidade (SaveReachIndex / LoadReachIndex) */
+#define REACHFILE_MAGICO "RCHB"
+#define REACHFILE_VERSAO 1
+
+/*
+ * Nmero mximo de componentes fortemente conexas do ndice. Os vetores de bits ocupam
+ * numComponentes * numComponentes / 8 bytes: 131072 componentes so 2 GB. Acima deste limite
+ * BuildReachIndex falha com REACH_ERRO_COMPONENTES e as consultas devem ser feitas sem ndice
+ * (BidirectionalSearchCSR, ou ReachableBatchCSR para muitos pares de uma vez).
+ */
+#define REACH_MAX_COMPONENTES (1 << 17)
+
+/* Cdigos de erro de BuildReachIndex */
+#define REACH_SEM_ERRO 0                /* ndice construdo */
+#define REACH_ERRO_ARGUMENTOS -1        /* Estrutura CSR invlida */
+#define REACH_ERRO_MEMORIA -2           /* Falta de memria */
+#define REACH_ERRO_COMPONENTES -3       /* Mais de REACH_MAX_COMPONENTES componentes */
+
+ /**
+  * @brief Cabealho do ficheiro com um ndice de alcanabilidade.
+  *
+  *  seguido dos vetores ids (numVertices inteiros), componentes (numVertices inteiros)
+  * e alcance (numComponentes * palavras inteiros de 64 bits), na ordem de bytes da mquina.
+  */
+typedef struct
+{
+    char magico[4];     /* REACHFILE_MAGICO, sem o '\0' */
+    int versao;         /* REACHFILE_VERSAO */
+    int numVertices;    /* Nmero de vrtices */
+    int numComponentes; /* Nmero de componentes fortemente conexas */
+    int palavras;       /* Palavras de 64 bits por componente */
+} ReachFileHeader;
+
+ /**
+  * @brief Estrutura para representar um ndice de alcanabilidade.
+  *
+  * As componentes esto numeradas por ordem topolgica inversa: todas as componentes
+  * alcanadas pela componente i (exceto ela prpria) tm nmero menor do que i.
+  */
+typedef struct ReachIndex
+{
+    int numVertices;        /* Nmero de vrtices */
+    int numComponentes;     /* Nmero de componentes fortemente conexas */
+    int palavras;           /* Palavras de 64 bits por componente em alcance */
+    int* ids;               /* ID de cada vrtice (ordenado por ordem crescente, como na estrutura CSR) */
+    int* componentes;       /* Componente de cada vrtice */
+    uint64_t* alcance;      /* Bit j da linha i: a componente i alcana a componente j (inclui i) */
+} ReachIndex;
+
+ReachIndex* BuildReachIndex(CSR* c, int numThreads, int* erro, bool* res);
+ReachIndex* DestroyReachIndex(ReachIndex* r, bool* res);
+bool ReachableIndex(ReachIndex* r, int origem, int dest);
+bool SaveReachIndex(ReachIndex* r, const char* ficheiro);
+ReachIndex* LoadReachIndex(const char* ficheiro, bool* res);
+
+#endif /* REACHINDEX_H */
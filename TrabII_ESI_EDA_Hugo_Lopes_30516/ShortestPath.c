@@ -0,0 +1,648 @@
+/**
+ * @file   ShortestPath.c
+ * @author Hugo Lopes_30516
+ *
+ * @brief Implementao do clculo de caminhos mais curtos (algoritmos de Dijkstra e delta-stepping).
+ *
+ * @date   Outubro 2026
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <malloc.h>
+#include <stdbool.h>
+#include "Graph.h"
+#include "CSR.h"
+#include "DHeap.h"
+#include "Threads.h"
+#include "ShortestPath.h"
+
+/* Nmero de vrtices da fase a partir do qual vale a pena acrescentar mais uma thread */
+#define DELTA_VERTICES_POR_THREAD 256
+
+/* Nmero mximo de baldes (o delta  aumentado se o maior peso exigir mais) */
+#define DELTA_MAX_BALDES (1 << 20)
+
+ /**
+  * @brief Relaxao bem-sucedida de uma adjacncia, registada pela thread que a fez.
+  */
+typedef struct
+{
+    long long distancia;    /* Nova distncia do vrtice */
+    int vertice;            /* ndice do vrtice */
+} RelaxacaoDelta;
+
+ /**
+  * @brief Argumento de cada thread numa fase do algoritmo delta-stepping.
+  */
+typedef struct
+{
+    CSR* c;                     /* Estrutura CSR */
+    long long* distancia;       /* Distncias provisrias, partilhadas entre as threads */
+    const int* lista;           /* Vrtices da fase */
+    int inicio;                 /* Parte desta thread: lista[inicio..fim) */
+    int fim;
+    long long delta;            /* Largura dos baldes */
+    bool leves;                 /* Relaxa as adjacncias leves (peso <= delta) ou as pesadas */
+    RelaxacaoDelta* novas;      /* Relaxaes feitas por esta thread (mantidas entre fases) */
+    int numNovas;
+    int capNovas;
+    bool ok;                    /* false se faltou memria */
+} TrabalhadorDelta;
+
+ /**
+  * @brief Balde de vrtices com distncia provisria no mesmo intervalo de largura delta.
+  */
+typedef struct
+{
+    int* vertices;
+    int tam;
+    int capacidade;
+} BaldeDelta;
+
+
+#pragma region Cria uma estrutura para os resultados de caminhos mais curtos.
+/**
+ * @brief Cria uma estrutura para os resultados de DijkstraGraph e DijkstraCSR.
+ *
+ * @param capacidade Nmero de vrtices esperado (os vetores crescem no clculo, se necessrio).
+ * @param res Apontador para um booleano que indica se a operao foi bem-sucedida.
+ * @return Um apontador para a estrutura criada, ou NULL se faltar memria.
+ */
+ShortestPath* CreateShortestPath(int capacidade, bool* res)
+{
+    *res = false;
+
+    ShortestPath* sp = (ShortestPath*)calloc(1, sizeof(ShortestPath));
+    if (sp == NULL) return NULL;
+    if (capacidade < 16) capacidade = 16;
+
+    sp->epocas = (unsigned int*)calloc(capacidade, sizeof(unsigned int));
+    sp->distancia = (long long*)malloc(capacidade * sizeof(long long));
+    sp->anteriores = (int*)malloc(capacidade * sizeof(int));
+    sp->ids = (int*)malloc(capacidade * sizeof(int));
+    if (sp->epocas == NULL || sp->distancia == NULL || sp->anteriores == NULL || sp->ids == NULL
+        || !CreateDHeap(&sp->fila, capacidade))
+    {
+        DestroyShortestPath(sp, res);
+        *res = false;
+        return NULL;
+    }
+
+    sp->capacidade = capacidade;
+    sp->origem = sp->destino = -1;
+    *res = true;
+    return sp;
+}
+#pragma endregion
+
+
+#pragma region Liberta a memria de uma estrutura de caminhos mais curtos.
+/**
+ * @brief Liberta a memria de uma estrutura de resultados de caminhos mais curtos.
+ *
+ * @param sp A estrutura a libertar.
+ * @param res Apontador para um booleano que indica se a operao foi bem-sucedida.
+ * @return NULL (no h mais estrutura para apontar).
+ */
+ShortestPath* DestroyShortestPath(ShortestPath* sp, bool* res)
+{
+    if (sp == NULL)
+    {
+        *res = false;
+        return NULL;
+    }
+
+    free(sp->epocas);
+    free(sp->distancia);
+    free(sp->anteriores);
+    free(sp->ids);
+    DestroyDHeap(&sp->fila);
+    free(sp);
+
+    *res = true;
+    return NULL;
+}
+#pragma endregion
+
+
+#pragma region Prepara a estrutura para um novo clculo.
+/**
+ * @brief Garante n posies em cada vetor e comea um novo clculo (nova poca).
+ */
+static bool IniciaShortestPath(ShortestPath* sp, int n)
+{
+    if (n > sp->capacidade)
+    {
+        int novaCap = sp->capacidade * 2;
+        if (novaCap < n) novaCap = n;
+
+        unsigned int* epocas = (unsigned int*)realloc(sp->epocas, novaCap * sizeof(unsigned int));
+        if (epocas == NULL) return false;
+        memset(epocas + sp->capacidade, 0, (novaCap - sp->capacidade) * sizeof(unsigned int));
+        sp->epocas = epocas;
+
+        long long* distancia = (long long*)realloc(sp->distancia, novaCap * sizeof(long long));
+        if (distancia == NULL) return false;
+        sp->distancia = distancia;
+
+        int** vetores[2] = { &sp->anteriores, &sp->ids };
+        for (int i = 0; i < 2; i++)
+        {
+            int* novo = (int*)realloc(*vetores[i], novaCap * sizeof(int));
+            if (novo == NULL) return false;
+            *vetores[i] = novo;
+        }
+        if (!ResizeDHeap(&sp->fila, novaCap)) return false;
+        sp->capacidade = novaCap;
+    }
+
+    // A fila pode ter ficado com vrtices de um clculo terminado mais cedo
+    ClearDHeap(&sp->fila);
+    if (++sp->epoca == 0)
+    {
+        memset(sp->epocas, 0, sp->capacidade * sizeof(unsigned int));
+        sp->epoca = 1;
+    }
+    sp->n = n;
+    return true;
+}
+#pragma endregion
+
+
+#pragma region Relaxa uma adjacncia.
+/**
+ * @brief Tenta melhorar a distncia do vrtice k atravs de u; se melhorar, (re)coloca k na fila.
+ */
+static void RelaxaShortestPath(ShortestPath* sp, int u, int k, int id, long long dist)
+{
+    if (sp->epocas[k] != sp->epoca)
+    {
+        sp->epocas[k] = sp->epoca;
+        sp->ids[k] = id;
+    }
+    else if (dist >= sp->distancia[k]) return;
+
+    sp->distancia[k] = dist;
+    sp->anteriores[k] = u;
+    PushDHeap(&sp->fila, k, dist);
+}
+#pragma endregion
+
+
+#pragma region Relaxa as adjacncias de uma parte da fase.
+/**
+ * @brief Relaxa as adjacncias leves ou pesadas dos vrtices lista[inicio..fim).
+ *
+ * Vrias threads podem melhorar a mesma distncia ao mesmo tempo: a distncia s  escrita
+ * com CompareExchangeThread se continuar maior do que a nova, e cada melhoria fica registada
+ * em novas, para o vrtice ser colocado no balde certo depois da fase.
+ */
+static void TrabalhaDelta(void* argumento)
+{
+    TrabalhadorDelta* w = (TrabalhadorDelta*)argumento;
+    CSR* c = w->c;
+    w->numNovas = 0;
+
+    for (int i = w->inicio; i < w->fim && w->ok; i++)
+    {
+        int u = w->lista[i];
+        long long du = LoadAtomicThread(&w->distancia[u]);
+
+        for (int e = c->offsets[u]; e < c->offsets[u + 1]; e++)
+        {
+            if ((c->pesos[e] <= w->delta) != w->leves) continue;
+
+            int v = c->destinos[e];
+            long long nova = du + c->pesos[e];
+            long long atual = LoadAtomicThread(&w->distancia[v]);
+            while (nova < atual)
+            {
+                long long vista = CompareExchangeThread(&w->distancia[v], atual, nova);
+                if (vista != atual)
+                {
+                    atual = vista; // Outra thread mudou a distncia entretanto
+                    continue;
+                }
+
+                if (w->numNovas == w->capNovas)
+                {
+                    int novaCap = (w->capNovas > 0) ? w->capNovas * 2 : 1024;
+                    RelaxacaoDelta* novo = (RelaxacaoDelta*)realloc(w->novas, novaCap * sizeof(RelaxacaoDelta));
+                    if (novo == NULL)
+                    {
+                        w->ok = false;
+                        return;
+                    }
+                    w->novas = novo;
+                    w->capNovas = novaCap;
+                }
+                w->novas[w->numNovas].distancia = nova;
+                w->novas[w->numNovas].vertice = v;
+                w->numNovas++;
+                break;
+            }
+        }
+    }
+}
+#pragma endregion
+
+
+#pragma region Executa uma fase do algoritmo delta-stepping.
+/**
+ * @brief Relaxa em paralelo as adjacncias (leves ou pesadas) dos vrtices de lista e coloca
+ *        nos baldes os vrtices cuja distncia melhorou.
+ *
+ * Depois de as threads terminarem, a distncia de cada vrtice alterado corresponde a uma
+ * nica relaxao registada (as distncias s descem). O vrtice  colocado no balde da nova
+ * distncia, a menos que j l esteja (marcas).
+ *
+ * @return true se a fase foi feita; false se faltou memria.
+ */
+static bool FaseDelta(ShortestPath* sp, TrabalhadorDelta* trabalhadores, int numThreads, const int* lista, int tam,
+    bool leves, BaldeDelta* baldes, long long numBaldes, long long* marcas, long long* entradas)
+{
+    if (tam == 0) return true;
+
+    int T = tam / DELTA_VERTICES_POR_THREAD + 1;
+    if (T > numThreads) T = numThreads;
+    for (int k = 0; k < T; k++)
+    {
+        trabalhadores[k].lista = lista;
+        trabalhadores[k].inicio = (int)((long long)tam * k / T);
+        trabalhadores[k].fim = (int)((long long)tam * (k + 1) / T);
+        trabalhadores[k].leves = leves;
+    }
+    RunThreads(T, TrabalhaDelta, trabalhadores, sizeof(TrabalhadorDelta));
+
+    long long delta = trabalhadores[0].delta;
+    for (int k = 0; k < T; k++)
+    {
+        if (!trabalhadores[k].ok) return false;
+
+        for (int i = 0; i < trabalhadores[k].numNovas; i++)
+        {
+            RelaxacaoDelta* r = &trabalhadores[k].novas[i];
+            if (r->distancia != sp->distancia[r->vertice]) continue; // Melhorada outra vez na mesma fase
+
+            int v = r->vertice;
+            long long b = r->distancia / delta;
+            if (marcas[v] == b) continue;
+
+            BaldeDelta* balde = &baldes[b % numBaldes];
+            if (balde->tam == balde->capacidade)
+            {
+                int novaCap = (balde->capacidade > 0) ? balde->capacidade * 2 : 16;
+                int* novo = (int*)realloc(balde->vertices, novaCap * sizeof(int));
+                if (novo == NULL) return false;
+                balde->vertices = novo;
+                balde->capacidade = novaCap;
+            }
+            balde->vertices[balde->tam++] = v;
+            marcas[v] = b;
+            (*entradas)++;
+        }
+    }
+    return true;
+}
+#pragma endregion
+
+
+#pragma region Escolhe os antecessores depois do delta-stepping.
+/**
+ * @brief Escolhe o antecessor de cada vrtice alcanado, com as distncias j definitivas.
+ *
+ * O antecessor de v , entre as adjacncias u -> v com dist[u] + peso == dist[v], o vrtice u
+ * com menor (dist[u], u). Com pesos positivos  a ordem em que DijkstraCSR retira os vrtices
+ * da fila, e o primeiro u retirado que atinge a distncia final de v  o que fica como seu
+ * antecessor: os resultados no dependem da ordem em que as threads fizeram as relaxaes.
+ * Percorrer os vrtices por ordem de ndice resolve os empates de distncia.
+ */
+static void EscolheAnterioresDelta(CSR* c, ShortestPath* sp)
+{
+    const long long* dist = sp->distancia;
+    int* anteriores = sp->anteriores;
+
+    for (int u = 0; u < c->numVertices; u++)
+    {
+        long long du = dist[u];
+        if (du == DISTANCIA_INFINITA) continue;
+
+        for (int e = c->offsets[u]; e < c->offsets[u + 1]; e++)
+        {
+            int v = c->destinos[e];
+            if (v == sp->origem || du + c->pesos[e] != dist[v]) continue;
+
+            int a = anteriores[v];
+            if (a < 0 || du < dist[a]) anteriores[v] = u;
+        }
+    }
+}
+#pragma endregion
+
+
+#pragma region ALGORITMOS
+
+/**
+ * @brief Caminhos mais curtos a partir de um vrtice do grafo (algoritmo de Dijkstra).
+ *
+ * Percorre as listas de adjacncias do grafo. Os resultados ficam em sp, indexados pela
+ * posio densa dos vrtices (Node::slot). Se destino for diferente de SEM_DESTINO, o clculo
+ * pra quando o destino  retirado da fila: s as distncias dos vrtices j retirados ficam
+ * definitivas.
+ *
+ * @param g O apontador para o grafo.
+ * @param origem O ID do vrtice de origem.
+ * @param destino O ID do vrtice de destino, ou SEM_DESTINO.
+ * @param sp A estrutura onde so guardados os resultados (criada com CreateShortestPath e reutilizvel).
+ * @return true se o clculo foi feito; false se um dos vrtices no existir, se for encontrada
+ *         uma adjacncia com peso negativo ou se faltar memria.
+ */
+bool DijkstraGraph(Graph* g, int origem, int destino, ShortestPath* sp)
+{
+    if (g == NULL || sp == NULL) return false;
+
+    Node* inicio = FindHashVertice(&g->indice, origem);
+    if (inicio == NULL) return false;
+
+    int alvo = -1;
+    if (destino != SEM_DESTINO)
+    {
+        Node* fim = FindHashVertice(&g->indice, destino);
+        if (fim == NULL) return false;
+        alvo = fim->slot;
+    }
+
+    if (!IniciaShortestPath(sp, g->numeroVertices)) return false;
+    sp->origem = inicio->slot;
+    sp->destino = alvo;
+    RelaxaShortestPath(sp, inicio->slot, inicio->slot, origem, 0);
+
+    long long dist;
+    int u;
+    while ((u = PopDHeap(&sp->fila, &dist)) >= 0)
+    {
+        if (u == alvo) break; // Distncia at ao destino definitiva
+
+        for (Adjacent* adj = g->slots[u]->nextAdjacent; adj != NULL; adj = adj->next)
+        {
+            if (adj->peso < 0)
+            {
+                ClearDHeap(&sp->fila);
+                return false;
+            }
+
+            Node* w = FindHashVertice(&g->indice, adj->id);
+            if (w != NULL) RelaxaShortestPath(sp, u, w->slot, w->id, dist + adj->peso);
+        }
+    }
+
+    return true;
+}
+
+
+/**
+ * @brief Caminhos mais curtos a partir de um vrtice de uma estrutura CSR (algoritmo de Dijkstra).
+ *
+ * Equivalente a DijkstraGraph, com os resultados indexados pelo ndice dos vrtices na estrutura CSR.
+ *
+ * @param c A estrutura CSR.
+ * @param origem O ID do vrtice de origem.
+ * @param destino O ID do vrtice de destino, ou SEM_DESTINO.
+ * @param sp A estrutura onde so guardados os resultados (criada com CreateShortestPath e reutilizvel).
+ * @return true se o clculo foi feito; false se um dos vrtices no existir, se for encontrada
+ *         uma adjacncia com peso negativo ou se faltar memria.
+ */
+bool DijkstraCSR(CSR* c, int origem, int destino, ShortestPath* sp)
+{
+    if (c == NULL || sp == NULL) return false;
+
+    int s = IndexCSR(c, origem);
+    if (s < 0) return false;
+
+    int alvo = -1;
+    if (destino != SEM_DESTINO)
+    {
+        alvo = IndexCSR(c, destino);
+        if (alvo < 0) return false;
+    }
+
+    if (!IniciaShortestPath(sp, c->numVertices)) return false;
+    sp->origem = s;
+    sp->destino = alvo;
+    RelaxaShortestPath(sp, s, s, origem, 0);
+
+    long long dist;
+    int u;
+    while ((u = PopDHeap(&sp->fila, &dist)) >= 0)
+    {
+        if (u == alvo) break; // Distncia at ao destino definitiva
+
+        for (int e = c->offsets[u]; e < c->offsets[u + 1]; e++)
+        {
+            if (c->pesos[e] < 0)
+            {
+                ClearDHeap(&sp->fila);
+                return false;
+            }
+
+            int k = c->destinos[e];
+            RelaxaShortestPath(sp, u, k, c->ids[k], dist + c->pesos[e]);
+        }
+    }
+
+    return true;
+}
+
+/**
+ * @brief Caminhos mais curtos a partir de um vrtice de uma estrutura CSR (algoritmo delta-stepping, em paralelo).
+ *
+ * As distncias provisrias so agrupadas em baldes de largura delta, processados por ordem.
+ * Os vrtices do balde atual relaxam as adjacncias leves (peso <= delta) em paralelo, o que
+ * pode voltar a encher o mesmo balde; quando o balde fica vazio, os vrtices que passaram por
+ * ele relaxam as adjacncias pesadas, que s alcanam baldes seguintes. Dentro de uma fase,
+ * as threads atualizam as distncias com operaes atmicas (CompareExchangeThread).
+ * Os baldes so circulares: bastam maiorPeso / delta + 2, porque uma relaxao nunca salta
+ * mais do que isso para a frente do balde atual.
+ *
+ * As distncias so as mesmas de DijkstraCSR e os resultados ficam em sp da mesma forma
+ * (DistanceShortestPath, PathShortestPath). Os antecessores so escolhidos numa passagem
+ * final, depois de as distncias estarem definitivas (EscolheAnterioresDelta): com pesos
+ * positivos, so os mesmos de DijkstraCSR, mesmo que haja vrios caminhos com a distncia mnima.
+ *
+ * @param c A estrutura CSR.
+ * @param origem O ID do vrtice de origem.
+ * @param delta A largura dos baldes, ou DELTA_AUTOMATICO para maiorPeso * V / E.
+ * @param numThreads O nmero de threads (<= 0 para um por processador).
+ * @param sp A estrutura onde so guardados os resultados (criada com CreateShortestPath e reutilizvel).
+ * @return true se o clculo foi feito; false se o vrtice no existir, se houver uma adjacncia
+ *         com peso negativo ou se faltar memria.
+ */
+bool DeltaSteppingCSR(CSR* c, int origem, long long delta, int numThreads, ShortestPath* sp)
+{
+    if (c == NULL || sp == NULL) return false;
+
+    int s = IndexCSR(c, origem);
+    if (s < 0) return false;
+
+    // O maior peso define o nmero de baldes
+    long long maiorPeso = 0;
+    for (int e = 0; e < c->numArestas; e++)
+    {
+        if (c->pesos[e] < 0) return false;
+        if (c->pesos[e] > maiorPeso) maiorPeso = c->pesos[e];
+    }
+
+    int n = c->numVertices;
+    if (delta <= 0) delta = (c->numArestas > 0) ? maiorPeso * n / c->numArestas : 1;
+    if (delta < 1) delta = 1;
+    if (maiorPeso / delta + 2 > DELTA_MAX_BALDES) delta = maiorPeso / (DELTA_MAX_BALDES - 2) + 1;
+    long long numBaldes = maiorPeso / delta + 2;
+
+    if (!IniciaShortestPath(sp, n)) return false;
+    sp->origem = s;
+    sp->destino = -1;
+
+    BaldeDelta* baldes = (BaldeDelta*)calloc((size_t)numBaldes, sizeof(BaldeDelta));
+    long long* marcas = (long long*)malloc(n * sizeof(long long));        // Balde em que cada vrtice est (-1 se nenhum)
+    long long* processados = (long long*)malloc(n * sizeof(long long));   // ltimo balde por onde cada vrtice passou
+    int* fase = (int*)malloc(n * sizeof(int));
+    int* passaram = (int*)malloc(n * sizeof(int));
+    bool ok = baldes != NULL && marcas != NULL && processados != NULL && fase != NULL && passaram != NULL;
+
+    int T = ThreadCount(numThreads);
+    TrabalhadorDelta trabalhadores[MAX_THREADS];
+    memset(trabalhadores, 0, T * sizeof(TrabalhadorDelta));
+    for (int k = 0; k < T; k++)
+    {
+        trabalhadores[k].c = c;
+        trabalhadores[k].distancia = sp->distancia;
+        trabalhadores[k].delta = delta;
+        trabalhadores[k].ok = true;
+    }
+
+    // A origem comea sozinha no balde 0
+    if (ok)
+    {
+        for (int i = 0; i < n; i++)
+        {
+            sp->distancia[i] = DISTANCIA_INFINITA;
+            sp->anteriores[i] = -1;
+            marcas[i] = processados[i] = -1;
+        }
+        sp->distancia[s] = 0;
+        sp->anteriores[s] = s;
+
+        baldes[0].vertices = (int*)malloc(16 * sizeof(int));
+        ok = baldes[0].vertices != NULL;
+        if (ok)
+        {
+            baldes[0].capacidade = 16;
+            baldes[0].vertices[baldes[0].tam++] = s;
+            marcas[s] = 0;
+        }
+    }
+
+    long long entradas = ok ? 1 : 0;
+    for (long long atual = 0; ok && entradas > 0; atual++)
+    {
+        BaldeDelta* balde = &baldes[atual % numBaldes];
+        if (balde->tam == 0) continue;
+
+        // Esvazia o balde atual, relaxando as adjacncias leves, at no voltar a encher
+        int tamPassaram = 0;
+        while (ok && balde->tam > 0)
+        {
+            int tamFase = 0;
+            for (int i = 0; i < balde->tam; i++)
+            {
+                int v = balde->vertices[i];
+                entradas--;
+                if (marcas[v] != atual) continue; // Entrada antiga: o vrtice j mudou de balde
+
+                marcas[v] = -1;
+                fase[tamFase++] = v;
+                if (processados[v] != atual)
+                {
+                    processados[v] = atual;
+                    passaram[tamPassaram++] = v;
+                }
+            }
+            balde->tam = 0;
+            ok = FaseDelta(sp, trabalhadores, T, fase, tamFase, true, baldes, numBaldes, marcas, &entradas);
+        }
+
+        // As adjacncias pesadas dos vrtices que passaram pelo balde s alcanam baldes seguintes
+        if (ok) ok = FaseDelta(sp, trabalhadores, T, passaram, tamPassaram, false, baldes, numBaldes, marcas, &entradas);
+    }
+
+    // Escolhe os antecessores e marca os vrtices alcanados como resultados deste clculo
+    if (ok)
+    {
+        EscolheAnterioresDelta(c, sp);
+        for (int i = 0; i < n; i++)
+        {
+            if (sp->distancia[i] == DISTANCIA_INFINITA) continue;
+            sp->epocas[i] = sp->epoca;
+            sp->ids[i] = c->ids[i];
+        }
+    }
+
+    for (int k = 0; k < T; k++) free(trabalhadores[k].novas);
+    if (baldes != NULL)
+    {
+        for (long long b = 0; b < numBaldes; b++) free(baldes[b].vertices);
+    }
+    free(baldes);
+    free(marcas);
+    free(processados);
+    free(fase);
+    free(passaram);
+    return ok;
+}
+
+
+/**
+ * @brief Distncia desde a origem at um vrtice, no ltimo clculo.
+ *
+ * @param sp A estrutura preenchida por DijkstraGraph ou DijkstraCSR.
+ * @param k A posio densa do vrtice.
+ * @return A distncia, ou DISTANCIA_INFINITA se o vrtice no foi alcanado.
+ */
+long long DistanceShortestPath(ShortestPath* sp, int k)
+{
+    if (sp == NULL || k < 0 || k >= sp->n || sp->epocas[k] != sp->epoca) return DISTANCIA_INFINITA;
+    return sp->distancia[k];
+}
+
+
+/**
+ * @brief Reconstri o caminho mais curto desde a origem at um vrtice, no ltimo clculo.
+ *
+ * O caminho s  escrito se couber em max posies; caso contrrio, o valor devolvido
+ * indica o tamanho necessrio.
+ *
+ * @param sp A estrutura preenchida por DijkstraGraph ou DijkstraCSR.
+ * @param k A posio densa do vrtice final.
+ * @param caminho Vetor que recebe os IDs dos vrtices, da origem at ao vrtice final.
+ * @param max Nmero de posies de caminho.
+ * @return O nmero de vrtices do caminho, ou 0 se o vrtice no foi alcanado.
+ */
+int PathShortestPath(ShortestPath* sp, int k, int* caminho, int max)
+{
+    if (DistanceShortestPath(sp, k) == DISTANCIA_INFINITA) return 0;
+
+    int tam = 1;
+    for (int j = k; j != sp->origem; j = sp->anteriores[j]) tam++;
+    if (tam > max || caminho == NULL) return tam;
+
+    int i = tam;
+    for (int j = k; ; j = sp->anteriores[j])
+    {
+        caminho[--i] = sp->ids[j];
+        if (j == sp->origem) break;
+    }
+    return tam;
+}
+
+#pragma endregion
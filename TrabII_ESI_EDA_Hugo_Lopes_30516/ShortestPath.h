@@ -0,0 +1,67 @@
+/**
+ * @file   ShortestPath.h
+ * @brief  Definies do clculo de caminhos mais curtos (algoritmos de Dijkstra e delta-stepping).
+ *
+ * O clculo percorre as listas de adjacncias do grafo (ou os vetores de uma estrutura CSR)
+ * com uma fila de prioridade d-ria (DHeap), em O((V + E) log V). Se for indicado um vrtice
+ * de destino, o clculo termina assim que a distncia at ele fica definitiva. Os resultados
+ * ficam numa estrutura ShortestPath reutilizvel: as distncias de cada consulta so marcadas
+ * com o nmero da consulta (poca), pelo que uma nova consulta no precisa de percorrer
+ * todos os vrtices para as limpar. Para grafos grandes h tambm o algoritmo delta-stepping,
+ * que processa em paralelo os vrtices com distncias prximas e d as mesmas distncias.
+ *
+ * @date   Outubro 2026
+ * @author Hugo Lopes_30516
+ */
+
+#pragma once
+
+#define _CRT_SECURE_NO_WARNINGS
+
+#ifndef SHORTESTPATH_H
+#define SHORTESTPATH_H
+
+#include <stdbool.h>
+#include <limits.h>
+#include "Graph.h"
+#include "CSR.h"
+#include "DHeap.h"
+
+/* Distncia de um vrtice inalcanvel */
+#define DISTANCIA_INFINITA LLONG_MAX
+
+/* Valor do destino quando se pretendem as distncias para todos os vrtices */
+#define SEM_DESTINO INT_MIN
+
+/* Valor de delta para DeltaSteppingCSR escolher a largura dos baldes */
+#define DELTA_AUTOMATICO 0
+
+ /**
+  * @brief Estrutura para guardar os resultados de um clculo de caminhos mais curtos.
+  *
+  * Os vetores so indexados pela posio densa dos vrtices (Node::slot no grafo, ou o ndice
+  * na estrutura CSR). Uma posio s tem resultados vlidos se epocas[k] == epoca.
+  */
+typedef struct ShortestPath
+{
+    int n;                  /* Nmero de vrtices do ltimo clculo */
+    int capacidade;         /* Nmero de posies reservadas em cada vetor */
+    int origem;             /* Posio do vrtice de origem */
+    int destino;            /* Posio do vrtice de destino, ou -1 se no foi indicado */
+    unsigned int epoca;     /* Nmero do clculo atual (nunca  0) */
+    unsigned int* epocas;   /* Clculo em que cada posio foi alcanada */
+    long long* distancia;   /* Distncia desde a origem */
+    int* anteriores;        /* Posio do antecessor no caminho mais curto */
+    int* ids;               /* ID do vrtice de cada posio alcanada */
+    DHeap fila;             /* Fila de prioridade dos vrtices por visitar (uso interno) */
+} ShortestPath;
+
+ShortestPath* CreateShortestPath(int capacidade, bool* res);
+ShortestPath* DestroyShortestPath(ShortestPath* sp, bool* res);
+bool DijkstraGraph(Graph* g, int origem, int destino, ShortestPath* sp);
+bool DijkstraCSR(CSR* c, int origem, int destino, ShortestPath* sp);
+bool DeltaSteppingCSR(CSR* c, int origem, long long delta, int numThreads, ShortestPath* sp);
+long long DistanceShortestPath(ShortestPath* sp, int k);
+int PathShortestPath(ShortestPath* sp, int k, int* caminho, int max);
+
+#endif /* SHORTESTPATH_H */
@@ -0,0 +1,304 @@
+/**
+ * @file   Threads.c
+ * @author Hugo Lopes_30516
+ *
+ * @brief Implementao da camada mnima de threads (Win32 e POSIX).
+ *
+ * @date   Outubro 2026
+ */
+
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include "Threads.h"
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+ /**
+  * @brief Tarefa e argumento de uma thread (adaptador para a assinatura do sistema).
+  */
+typedef struct
+{
+    TarefaThread tarefa;
+    void* argumento;
+} ArranqueThread;
+
+ /**
+  * @brief Trinco do sistema.
+  */
+struct MutexThread
+{
+#ifdef _WIN32
+    CRITICAL_SECTION seccao;
+#else
+    pthread_mutex_t trinco;
+#endif
+};
+
+
+#pragma region Funo de arranque das threads.
+#ifdef _WIN32
+static DWORD WINAPI ArrancaThread(LPVOID p)
+{
+    ArranqueThread* a = (ArranqueThread*)p;
+    a->tarefa(a->argumento);
+    return 0;
+}
+#else
+static void* ArrancaThread(void* p)
+{
+    ArranqueThread* a = (ArranqueThread*)p;
+    a->tarefa(a->argumento);
+    return NULL;
+}
+#endif
+#pragma endregion
+
+
+#pragma region Devolve o nmero de processadores.
+/**
+ * @brief Devolve o nmero de processadores lgicos disponveis.
+ *
+ * @return O nmero de processadores (pelo menos 1).
+ */
+int NumProcessors(void)
+{
+#ifdef _WIN32
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    int n = (int)info.dwNumberOfProcessors;
+#else
+    int n = (int)sysconf(_SC_NPROCESSORS_ONLN);
+#endif
+    return (n > 0) ? n : 1;
+}
+#pragma endregion
+
+
+#pragma region Normaliza um nmero de threads pedido.
+/**
+ * @brief Normaliza um nmero de threads pedido pelo utilizador.
+ *
+ * @param pedidas O nmero pedido (<= 0 significa "um por processador").
+ * @return Um nmero entre 1 e MAX_THREADS.
+ */
+int ThreadCount(int pedidas)
+{
+    int n = (pedidas > 0) ? pedidas : NumProcessors();
+    if (n > MAX_THREADS) n = MAX_THREADS;
+    return n;
+}
+#pragma endregion
+
+
+#pragma region Executa uma tarefa em vrias threads.
+/**
+ * @brief Executa a tarefa em numThreads threads e espera que todas terminem.
+ *
+ * A thread i recebe o argumento (char*)argumentos + i * tamArgumento. A primeira tarefa
+ *  executada pela thread que chama a funo; se no for possvel criar uma thread,
+ * a sua tarefa tambm  executada pela thread que chama, pelo que o resultado  sempre
+ * o mesmo (apenas mais lento).
+ *
+ * @param numThreads O nmero de tarefas (entre 1 e MAX_THREADS).
+ * @param tarefa A funo a executar.
+ * @param argumentos Vetor com os argumentos das tarefas.
+ * @param tamArgumento O tamanho de cada argumento, em bytes.
+ * @return true se as tarefas foram executadas; false se os parmetros forem invlidos.
+ */
+bool RunThreads(int numThreads, TarefaThread tarefa, void* argumentos, size_t tamArgumento)
+{
+    if (tarefa == NULL || numThreads <= 0 || numThreads > MAX_THREADS) return false;
+
+    ArranqueThread arranques[MAX_THREADS];
+    bool criada[MAX_THREADS];
+#ifdef _WIN32
+    HANDLE handles[MAX_THREADS];
+#else
+    pthread_t handles[MAX_THREADS];
+#endif
+
+    // Lana as threads 1 .. numThreads-1
+    for (int i = 1; i < numThreads; i++)
+    {
+        arranques[i].tarefa = tarefa;
+        arranques[i].argumento = (char*)argumentos + (size_t)i * tamArgumento;
+#ifdef _WIN32
+        handles[i] = CreateThread(NULL, 0, ArrancaThread, &arranques[i], 0, NULL);
+        criada[i] = (handles[i] != NULL);
+#else
+        criada[i] = (pthread_create(&handles[i], NULL, ArrancaThread, &arranques[i]) == 0);
+#endif
+    }
+
+    // A tarefa 0 (e as que no tiveram thread) correm na thread atual
+    tarefa(argumentos);
+    for (int i = 1; i < numThreads; i++)
+    {
+        if (!criada[i]) tarefa(arranques[i].argumento);
+    }
+
+    // Espera que todas as threads terminem
+    for (int i = 1; i < numThreads; i++)
+    {
+        if (!criada[i]) continue;
+#ifdef _WIN32
+        WaitForSingleObject(handles[i], INFINITE);
+        CloseHandle(handles[i]);
+#else
+        pthread_join(handles[i], NULL);
+#endif
+    }
+    return true;
+}
+#pragma endregion
+
+
+#pragma region Cria um trinco.
+/**
+ * @brief Cria um trinco (excluso mtua) livre.
+ *
+ * @return O trinco, ou NULL se faltar memria.
+ */
+MutexThread* CreateMutexThread(void)
+{
+    MutexThread* m = (MutexThread*)malloc(sizeof(MutexThread));
+    if (m == NULL) return NULL;
+#ifdef _WIN32
+    InitializeCriticalSection(&m->seccao);
+#else
+    if (pthread_mutex_init(&m->trinco, NULL) != 0)
+    {
+        free(m);
+        return NULL;
+    }
+#endif
+    return m;
+}
+#pragma endregion
+
+
+#pragma region Liberta um trinco.
+/**
+ * @brief Liberta um trinco (que no pode estar fechado).
+ *
+ * @param m O trinco.
+ * @return NULL (no h mais trinco para apontar).
+ */
+MutexThread* DestroyMutexThread(MutexThread* m)
+{
+    if (m == NULL) return NULL;
+#ifdef _WIN32
+    DeleteCriticalSection(&m->seccao);
+#else
+    pthread_mutex_destroy(&m->trinco);
+#endif
+    free(m);
+    return NULL;
+}
+#pragma endregion
+
+
+#pragma region Fecha um trinco.
+/**
+ * @brief Fecha o trinco, esperando que fique livre.
+ *
+ * @param m O trinco.
+ */
+void LockMutexThread(MutexThread* m)
+{
+#ifdef _WIN32
+    EnterCriticalSection(&m->seccao);
+#else
+    pthread_mutex_lock(&m->trinco);
+#endif
+}
+#pragma endregion
+
+
+#pragma region Abre um trinco.
+/**
+ * @brief Abre o trinco fechado pela thread atual.
+ *
+ * @param m O trinco.
+ */
+void UnlockMutexThread(MutexThread* m)
+{
+#ifdef _WIN32
+    LeaveCriticalSection(&m->seccao);
+#else
+    pthread_mutex_unlock(&m->trinco);
+#endif
+}
+#pragma endregion
+
+
+#pragma region Marca um bit de forma atmica.
+/**
+ * @brief Liga o bit de um vetor de bits partilhado, se ainda estiver desligado.
+ *
+ * Quando vrias threads tentam ligar o mesmo bit ao mesmo tempo, s uma recebe true;
+ * um bit j ligado  detetado com uma leitura simples, sem a operao atmica.
+ *
+ * @param palavras O vetor de bits (palavras de 64 bits).
+ * @param bit O nmero do bit.
+ * @return true se foi esta chamada que ligou o bit; false se j estava ligado.
+ */
+bool TestAndSetBitThread(uint64_t* palavras, int bit)
+{
+    uint64_t mascara = (uint64_t)1 << (bit % 64);
+#ifdef _WIN32
+    volatile LONG64* p = (volatile LONG64*)&palavras[bit / 64];
+    if ((uint64_t)*p & mascara) return false;
+    return ((uint64_t)InterlockedOr64(p, (LONG64)mascara) & mascara) == 0;
+#else
+    uint64_t* p = &palavras[bit / 64];
+    if (__atomic_load_n(p, __ATOMIC_RELAXED) & mascara) return false;
+    return (__atomic_fetch_or(p, mascara, __ATOMIC_RELAXED) & mascara) == 0;
+#endif
+}
+#pragma endregion
+
+
+#pragma region L um valor partilhado.
+/**
+ * @brief L um valor que outras threads podem estar a alterar com CompareExchangeThread.
+ *
+ * @param p O endereo do valor.
+ * @return O valor lido (nunca metade de um valor antigo e metade de um novo).
+ */
+long long LoadAtomicThread(long long* p)
+{
+#ifdef _WIN32
+    return *(volatile long long*)p;
+#else
+    return __atomic_load_n(p, __ATOMIC_RELAXED);
+#endif
+}
+#pragma endregion
+
+
+#pragma region Compara e troca um valor partilhado.
+/**
+ * @brief Substitui *p por novo, de forma atmica, se *p for igual a esperado.
+ *
+ * @param p O endereo do valor.
+ * @param esperado O valor que *p deve ter.
+ * @param novo O novo valor.
+ * @return O valor que *p tinha; a troca foi feita se for igual a esperado.
+ */
+long long CompareExchangeThread(long long* p, long long esperado, long long novo)
+{
+#ifdef _WIN32
+    return InterlockedCompareExchange64((volatile LONG64*)p, novo, esperado);
+#else
+    __atomic_compare_exchange_n(p, &esperado, novo, false, __ATOMIC_RELAXED, __ATOMIC_RELAXED);
+    return esperado;
+#endif
+}
+#pragma endregion
@@ -0,0 +1,48 @@
+/**
+ * @file   Threads.h
+ * @brief  Definies de uma camada mnima de threads (Win32 e POSIX).
+ *
+ * Permite executar a mesma tarefa em vrias threads e esperar que todas terminem
+ * (modelo fork-join), proteger dados partilhados com trincos e fazer operaes atmicas
+ * simples (marcar bits, comparar e trocar), sem depender de uma biblioteca externa.
+ *
+ * @date   Outubro 2026
+ * @author Hugo Lopes_30516
+ */
+
+#pragma once
+
+#define _CRT_SECURE_NO_WARNINGS
+
+#ifndef THREADS_H
+#define THREADS_H
+
+#include <stddef.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+/* Nmero mximo de threads lanadas por RunThreads */
+#define MAX_THREADS 256
+
+/**
+ * @brief Tarefa executada por cada thread; recebe o seu prprio argumento.
+ */
+typedef void (*TarefaThread)(void* argumento);
+
+/**
+ * @brief Trinco (excluso mtua) partilhado entre threads; a definio depende do sistema.
+ */
+typedef struct MutexThread MutexThread;
+
+int NumProcessors(void);
+int ThreadCount(int pedidas);
+bool RunThreads(int numThreads, TarefaThread tarefa, void* argumentos, size_t tamArgumento);
+MutexThread* CreateMutexThread(void);
+MutexThread* DestroyMutexThread(MutexThread* m);
+void LockMutexThread(MutexThread* m);
+void UnlockMutexThread(MutexThread* m);
+bool TestAndSetBitThread(uint64_t* palavras, int bit);
+long long LoadAtomicThread(long long* p);
+long long CompareExchangeThread(long long* p, long long esperado, long long novo);
+
+#endif /* THREADS_H */
@@ -14,6 +14,7 @@
 #include <stdbool.h>
 #include"Vertices.h"
 #include"VerticesAdjacent.h"
+#include"Arena.h"
 
 
 
@@ -42,8 +43,16 @@ Node* CreateVertice(int id, bool* res)
 	aux->id = id;
 
 	// Inicializa os campos do vrtice
+	aux->slot = -1;
+	aux->visitado = false;
+	aux->emArena = false;
+	aux->numAdj = 0;
 	aux->nextVertice = NULL;
+	aux->anteriorVertice = NULL;
 	aux->nextAdjacent = NULL;
+	aux->ultimoAdjacent = NULL;
+	aux->entradas = NULL;
+	aux->numEntradas = 0;
 
 	// Define res como verdadeiro para indicar sucesso
 	*res = true;
@@ -62,9 +71,10 @@ Node* CreateVertice(int id, bool* res)
 * @brief Liberta a memria alocada para um vrtice.
 *
 * @param ptNode Um apontador para o vrtice a ser destrudo.
+* @param arena A arena do grafo, usada se o vrtice tiver sido reservado dela.
 * @return true se a operao foi bem - sucedida, false caso contrrio.
 */
-bool DestroiVertice(Node* ptNode)
+bool DestroiVertice(Node* ptNode, Arena* arena)
 {
 	// Verifica se o apontador para o vrtice  vlido
 	if (ptNode == NULL)
@@ -74,8 +84,9 @@ bool DestroiVertice(Node* ptNode)
 	}
 
 	
-	// Liberta a memria alocada para o vrtice
-	free(ptNode);
+	// Liberta a memria alocada para o vrtice (ou devolve-o  arena)
+	if (ptNode->emArena && arena != NULL) FreeArena(arena, ptNode);
+	else free(ptNode);
 
 	// Retorna true para indicar que a operao foi bem-sucedida
 	return true;
@@ -218,6 +229,8 @@ Node* InsertVertice(Node* vertices, Node* novo, bool* res)
 		novo->nextVertice = aux;
 		ant->nextVertice = novo;
 	}
+	novo->anteriorVertice = ant;
+	if (aux != NULL) aux->anteriorVertice = novo;
 
 	return vertices;
 }
@@ -230,10 +243,12 @@ Node* InsertVertice(Node* vertices, Node* novo, bool* res)
  *
  * @param vertices O apontador para o incio da lista de vrtices.
  * @param codVertice O cdigo do vrtice a ser removido.
+ * @param arenaVertices A arena de vrtices do grafo (ou NULL).
+ * @param arenaAdj A arena de adjacncias do grafo (ou NULL).
  * @param res O apontador para uma varivel que armazenar o resultado da operao.
  * @return O apontador atualizado para o incio da lista de vrtices aps a remoo.
  */
-Node* DeleteVertice(Node* vertices, int codVertice, bool* res)
+Node* DeleteVertice(Node* vertices, int codVertice, Arena* arenaVertices, Arena* arenaAdj, bool* res)
 {
 	// Inicializa o resultado como falso
 	*res = false;
@@ -247,33 +262,31 @@ Node* DeleteVertice(Node* vertices, int codVertice, bool* res)
 	Node* ant = NULL;
 
 	// Percorre a lista at encontrar o vrtice com o cdigo especificado
-	while (aux->id != codVertice)
+	while (aux != NULL && aux->id != codVertice)
 	{
 		ant = aux;
 		aux = aux->nextVertice;
 	}
 	//no existe	
 	if (!aux) return vertices;
-		
-	
 
-	
-	if (ant == NULL)
-	{
-			aux->nextAdjacent = DeleteAllAdj(aux->nextAdjacent, res);
-			// Se a remoo dos vrtices adjacentes falhar, retorna a lista sem modificao
-		if (*res == false) return vertices;
+	// Liberta as adjacncias do vrtice removido
+	aux->nextAdjacent = DeleteAllAdj(aux->nextAdjacent, arenaAdj, res);
+	aux->ultimoAdjacent = NULL;
+	aux->numAdj = 0;
+	aux->entradas = DeleteAllAdj(aux->entradas, arenaAdj, res);
+	aux->numEntradas = 0;
 
+	// Se o vrtice a ser removido for o primeiro da lista
+	if (ant == NULL)
 		vertices = aux->nextVertice;
-	}
 	// Se o vrtice a ser removido estiver no meio ou no final da lista
 	else 
 		ant->nextVertice = aux->nextVertice;
-	
-		
+	if (aux->nextVertice != NULL) aux->nextVertice->anteriorVertice = ant;
 
 	// Liberta a memria alocada para o vrtice removido
-	DestroiVertice(aux);
+	DestroiVertice(aux, arenaVertices);
 
 	// Define o resultado como verdadeiro, pois a remoo foi bem-sucedida
 	*res = true;
@@ -290,10 +303,11 @@ Node* DeleteVertice(Node* vertices, int codVertice, bool* res)
  *
  * @param vertices O apontador para o incio da lista de vrtices.
  * @param codAdj O cdigo da adjacncia a ser removida de todos os vrtices.
+ * @param arenaAdj A arena de adjacncias do grafo (ou NULL).
  * @param res O apontador para uma varivel que armazenar o resultado da operao.
  * @return O apontador atualizado para o incio da lista de vrtices aps a remoo das adjacncias.
  */
-Node* DeleteAllAdjVert(Node* vertices, int codAdj, bool* res)
+Node* DeleteAllAdjVert(Node* vertices, int codAdj, Arena* arenaAdj, bool* res)
 {
 	// Inicializa o resultado como falso
 	*res = false;
@@ -309,7 +323,7 @@ Node* DeleteAllAdjVert(Node* vertices, int codAdj, bool* res)
 	while (aux)
 	{
 		// Remove as adjacncias com o cdigo especificado do vrtice atual
-		aux->nextAdjacent = DeleteAdj(aux->nextAdjacent, codAdj, res);
+		aux = DeleteAdjVertice(aux, codAdj, arenaAdj, res);
 
 		// Avana para o prximo vrtice na lista
 		aux = aux->nextVertice;
@@ -324,6 +338,88 @@ Node* DeleteAllAdjVert(Node* vertices, int codAdj, bool* res)
 #pragma endregion
 
 
+#pragma region Insere uma adjacncia no fim da lista de um vrtice.
+/**
+ * @brief Insere uma adjacncia no fim da lista de adjacncias de um vrtice, em tempo constante.
+ *
+ * Usa o apontador para a ltima adjacncia do vrtice em vez de percorrer a lista,
+ * e atualiza o nmero de adjacncias do vrtice. Tal como InsertAdj, as adjacncias
+ * com peso zero no so inseridas.
+ *
+ * @param vertice O vrtice de origem.
+ * @param idDestino O ID do vrtice de destino.
+ * @param peso O peso da adjacncia.
+ * @param arenaAdj A arena de adjacncias do grafo (ou NULL para usar malloc).
+ * @param res O apontador para uma varivel que indica se a adjacncia foi inserida.
+ * @return O apontador para o vrtice.
+ */
+Node* InsertAdjVertice(Node* vertice, int idDestino, int peso, Arena* arenaAdj, bool* res)
+{
+	*res = false;
+
+	// Verifica se o vrtice  vlido e se o peso  diferente de zero
+	if (vertice == NULL || peso == 0) return vertice;
+
+	// Cria a nova adjacncia
+	Adjacent* newAdj = NewAdjacent(idDestino, peso, arenaAdj);
+	if (newAdj == NULL) return vertice;
+
+	// Liga a nova adjacncia a seguir  ltima
+	if (vertice->ultimoAdjacent == NULL) vertice->nextAdjacent = newAdj;
+	else vertice->ultimoAdjacent->next = newAdj;
+	vertice->ultimoAdjacent = newAdj;
+	vertice->numAdj++;
+
+	*res = true;
+	return vertice;
+}
+#pragma endregion
+
+
+#pragma region Remove uma adjacncia da lista de um vrtice.
+/**
+ * @brief Remove a primeira adjacncia com o cdigo especificado da lista de um vrtice,
+ * mantendo atualizados a ltima adjacncia e o nmero de adjacncias do vrtice.
+ *
+ * @param vertice O vrtice de origem.
+ * @param codAdj O cdigo da adjacncia a remover.
+ * @param arenaAdj A arena de adjacncias do grafo (ou NULL).
+ * @param res O apontador para uma varivel que indica se a adjacncia foi removida.
+ * @return O apontador para o vrtice.
+ */
+Node* DeleteAdjVertice(Node* vertice, int codAdj, Arena* arenaAdj, bool* res)
+{
+	*res = false;
+	if (vertice == NULL) return NULL;
+
+	// Procura a adjacncia, guardando a anterior
+	Adjacent* ant = NULL;
+	Adjacent* aux = vertice->nextAdjacent;
+	while (aux != NULL && aux->id != codAdj)
+	{
+		ant = aux;
+		aux = aux->next;
+	}
+
+	// No existe
+	if (aux == NULL) return vertice;
+
+	// Desliga a adjacncia da lista
+	if (ant == NULL) vertice->nextAdjacent = aux->next;
+	else ant->next = aux->next;
+
+	// Se era a ltima, a anterior passa a ser a ltima
+	if (vertice->ultimoAdjacent == aux) vertice->ultimoAdjacent = ant;
+	vertice->numAdj--;
+
+	DestroyAdjacent(aux, arenaAdj);
+
+	*res = true;
+	return vertice;
+}
+#pragma endregion
+
+
 #pragma region Mostra os vrtices e suas adjacncias no grafo.
 /**
  * @brief Mostra os vrtices e suas adjacncias no grafo.
@@ -18,6 +18,7 @@
 
 #include <stdbool.h>
 #include"VerticesAdjacent.h"
+#include"Arena.h"
 
  /**
   * @brief Estrutura para representar os vrtices.
@@ -25,19 +26,28 @@
 typedef struct Node
 {
     int id;
+    int slot;                   /* Posio densa do vrtice no grafo (0 .. numeroVertices-1), ou -1 se no pertencer a um grafo */
     bool visitado;
+    bool emArena;               /* true se o vrtice foi reservado da arena do grafo */
+    int numAdj;                 /* Nmero de adjacncias (grau de sada) */
     struct Adjacent* nextAdjacent;
+    struct Adjacent* ultimoAdjacent; /* ltima adjacncia da lista (insero no fim em O(1)) */
+    struct Adjacent* entradas;  /* Adjacncias de entrada (id = vrtice de origem), se o grafo as mantiver */
+    int numEntradas;            /* Nmero de adjacncias de entrada (grau de entrada) */
     struct Node* nextVertice;
+    struct Node* anteriorVertice; /* Vrtice anterior da lista (remoo em O(1)) */
 } Node;
 
 
 Node* CreateVertice(int id, bool* res);
 Node* InsertVertice(Node* vertices, Node* novo, bool* res);
-Node* DeleteVertice(Node* vertices, int codVertice, bool* res);
+Node* DeleteVertice(Node* vertices, int codVertice, Arena* arenaVertices, Arena* arenaAdj, bool* res);
 Node* WhereIsVertice(Node* inicio, int id);
-Node* DeleteAllAdjVert(Node* vertices, int codAdj, bool* res);
+Node* DeleteAllAdjVert(Node* vertices, int codAdj, Arena* arenaAdj, bool* res);
+Node* InsertAdjVertice(Node* vertice, int idDestino, int peso, Arena* arenaAdj, bool* res);
+Node* DeleteAdjVertice(Node* vertice, int codAdj, Arena* arenaAdj, bool* res);
 bool ExistVertice(Node* inicio, int id);
 bool ShowGraph(Node* graph);
-bool DestroiVertice(Node* ptNode);
+bool DestroiVertice(Node* ptNode, Arena* arena);
 
 #endif /* VRT */
@@ -13,6 +13,7 @@
 #include<malloc.h>
 #include <stdbool.h>
 #include"VerticesAdjacent.h"
+#include"Arena.h"
 
 
 #pragma region Cria um novo n de adjacncia com o ID especificado.
@@ -22,15 +23,18 @@
  * Esta funo aloca memria para um novo n de adjacncia e define o ID especificado.
  *
  * @param id O ID da adjacncia a ser criada.
+ * @param peso O peso da adjacncia.
+ * @param arena A arena de onde o n  reservado, ou NULL para usar malloc.
  * @return Um apontador para o novo n de adjacncia, se a alocao de memria for bem-sucedida; NULL caso contrrio.
  */
-Adjacent* NewAdjacent(int id, int peso)
+Adjacent* NewAdjacent(int id, int peso, Arena* arena)
 {
 	// Declarao de um apontador para o novo n de adjacncia
 	Adjacent* adjacente;
 
-	// Aloca memria para o novo n de adjacncia
-	adjacente = (Adjacent*)malloc(sizeof(Adjacent));
+	// Aloca memria para o novo n de adjacncia (da arena, se existir)
+	if (arena != NULL) adjacente = (Adjacent*)AllocArena(arena);
+	else adjacente = (Adjacent*)malloc(sizeof(Adjacent));
 
 	// Verifica se a alocao de memria foi bem-sucedida
 	if (adjacente == NULL)
@@ -59,9 +63,11 @@ Adjacent* NewAdjacent(int id, int peso)
  *
  * @param listaAdj O apontador para a lista de adjacncias.
  * @param idDestino O ID de destino da nova adjacncia a ser inserida.
+ * @param peso O peso da nova adjacncia.
+ * @param arena A arena de onde o n  reservado, ou NULL para usar malloc.
  * @return Um apontador para a lista de adjacncias atualizada aps a insero.
  */
-Adjacent* InsertAdj(Adjacent* listaAdj, int idDestino, int peso)
+Adjacent* InsertAdj(Adjacent* listaAdj, int idDestino, int peso, Arena* arena)
 {
 	// Declarao do apontador para a nova adjacncia
 	Adjacent* newAdj;
@@ -73,7 +79,7 @@ Adjacent* InsertAdj(Adjacent* listaAdj, int idDestino, int peso)
 	}
 
 	// Cria uma nova adjacncia com o ID de destino especificado
-	if ((newAdj = NewAdjacent(idDestino, peso)) == NULL)
+	if ((newAdj = NewAdjacent(idDestino, peso, arena)) == NULL)
 	{
 		// Se a criao da nova adjacncia falhar, retorna a lista de adjacncias sem modificaes
 		return listaAdj;
@@ -109,9 +115,10 @@ Adjacent* InsertAdj(Adjacent* listaAdj, int idDestino, int peso)
  * @brief Liberta a memria alocada para um n de adjacncia.
  *
  * @param ptAdjacent O apontador para o n de adjacncia a ser liberado.
+ * @param arena A arena de onde o n foi reservado, ou NULL se foi criado com malloc.
  * @return true se a memria for libertada com sucesso; false caso contrrio.
  */
-bool DestroyAdjacent(Adjacent* ptAdjacent)
+bool DestroyAdjacent(Adjacent* ptAdjacent, Arena* arena)
 {
 	// Verifica se o apontador para o n de adjacncia  nulo
 	if (ptAdjacent == NULL)
@@ -120,8 +127,9 @@ bool DestroyAdjacent(Adjacent* ptAdjacent)
 		return false;
 	}
 
-	// Liberta a memria alocada para o n de adjacncia
-	free(ptAdjacent);
+	// Liberta a memria alocada para o n de adjacncia (ou devolve-o  arena para ser reutilizado)
+	if (arena != NULL) FreeArena(arena, ptAdjacent);
+	else free(ptAdjacent);
 
 	// Retorna true para indicar que a memria foi liberada com sucesso
 	return true;
@@ -136,10 +144,11 @@ bool DestroyAdjacent(Adjacent* ptAdjacent)
  *
  * @param listAdj O apontador para o incio da lista de adjacncias.
  * @param codAdj O cdigo da adjacncia a ser removida.
+ * @param arena A arena de onde os ns foram reservados, ou NULL se foram criados com malloc.
  * @param res O apontador para uma varivel que armazenar o resultado da operao.
  * @return O apontador atualizado para o incio da lista de adjacncias aps a remoo.
  */
-Adjacent* DeleteAdj(Adjacent* listAdj, int codAdj, bool* res)
+Adjacent* DeleteAdj(Adjacent* listAdj, int codAdj, Arena* arena, bool* res)
 {
 	// Inicializa o resultado como falso
 	*res = false;
@@ -182,7 +191,7 @@ Adjacent* DeleteAdj(Adjacent* listAdj, int codAdj, bool* res)
 	}
 
 	// Liberta a memria alocada para o n de adjacncia removido
-	free(aux);
+	DestroyAdjacent(aux, arena);
 
 	// Define o resultado como verdadeiro, pois a remoo foi bem-sucedida
 	*res = true;
@@ -199,10 +208,11 @@ Adjacent* DeleteAdj(Adjacent* listAdj, int codAdj, bool* res)
  * @brief Remove todos os ns de adjacncia de uma lista ligada de adjacncias.
  *
  * @param listaAdj O apontador para o incio da lista de adjacncias a serem removidas.
+ * @param arena A arena de onde os ns foram reservados, ou NULL se foram criados com malloc.
  * @param res O apontador para uma varivel que armazenar o resultado da operao.
  * @return O apontador atualizado para o incio da lista de adjacncias aps a remoo de todos os ns.
  */
-Adjacent* DeleteAllAdj(Adjacent* listaAdj, bool* res)
+Adjacent* DeleteAllAdj(Adjacent* listaAdj, Arena* arena, bool* res)
 {
 	// Inicializa o resultado como falso
 	*res = false;
@@ -222,7 +232,7 @@ Adjacent* DeleteAllAdj(Adjacent* listaAdj, bool* res)
 	{
 		// Armazena o prximo n antes de destruir o n atual
 		Adjacent* next = aux->next;
-		DestroyAdjacent(aux);
+		DestroyAdjacent(aux, arena);
 		aux = next;
 	}
 
@@ -17,6 +17,7 @@
 
 
 #include <stdbool.h>
+#include "Arena.h"
 
  /**
   * @brief Estrutura para representar as adjacncias.
@@ -30,11 +31,11 @@ typedef struct Adjacent
 
 
 
-Adjacent* NewAdjacent(int id,int peso);
-Adjacent* InsertAdj(Adjacent* listaAdj, int idDestino,int peso);
-bool DestroyAdjacent(Adjacent* ptAdjacent);
-Adjacent* DeleteAdj(Adjacent* listAdj, int codAdj, bool* res);
-Adjacent* DeleteAllAdj(Adjacent* listaAdj, bool* res);
+Adjacent* NewAdjacent(int id,int peso, Arena* arena);
+Adjacent* InsertAdj(Adjacent* listaAdj, int idDestino,int peso, Arena* arena);
+bool DestroyAdjacent(Adjacent* ptAdjacent, Arena* arena);
+Adjacent* DeleteAdj(Adjacent* listAdj, int codAdj, Arena* arena, bool* res);
+Adjacent* DeleteAllAdj(Adjacent* listaAdj, Arena* arena, bool* res);
 
 #endif /* VRTA */
 
@@ -40,19 +40,9 @@ int main()
     bool res;
     int totV, totA;
 
-    // L o grafo de um arquivo
-    Node2* ini = readFile("matriz.txt", &totV, &totA, &res);
+    // L a matriz do ficheiro e cria o grafo com os vrtices e adjacncias numa s passagem
+    Graph* novo = readFileGraph("matriz.txt", &totV, &totA, &res);
     if (!res) printf("Erro ao ler a matriz\n\n");
-    else printf("Dados carregados em memria com sucesso\n\n");
-
-    // Cria um novo grafo
-    Graph* novo = CreateGraph(&totV, &res);
-    if (!res) printf("Erro ao criar o grafo\n\n");
-    else printf("Grafo carregado com sucesso\n\n");
-
-    // Inserir vrtices e adjacncias a partir da estrutura inicial lida
-    novo = ins_vert_adj(novo, ini, &totV, &totA, &res);
-    if (!res) printf("Erro ao inserir vrtices e adjacncias\n\n");
     else printf("Grafo inicial\n\n");
 
     // Mostra o grafo aps a criao inicial
@@ -152,8 +142,9 @@ int main()
     ResetVerticesVisitados(novo);
    
     // Encontrar o caminho mais pesado entre dois vrtices
-    Best melhorCaminho = BestPath(novo,totA , 0);
-    ShowAllPath(melhorCaminho, totA, 0);
+    Best* melhorCaminho = CreateBest(totV, &res);
+    if (res && BestPath(novo, 0, melhorCaminho)) ShowAllPath(melhorCaminho);
+    melhorCaminho = DestroyBest(melhorCaminho, &res);
 
     // Apaga o grafo
     novo = DestroyGraph(novo, &res);